@@ -78,6 +78,16 @@ namespace dml::detail
         dif_app_tag_t app_tag_mask;
         dif_app_tag_t app_tag_seed;
     };
+
+    /**
+     * @brief How a thread waits for an operation to complete, values match dml_wait_mode_t
+     */
+    enum class wait_mode : std::uint8_t
+    {
+        busy_poll = 0u,
+        umwait    = 1u,
+        adaptive  = 2u
+    };
 }  // namespace dml::detail
 
 #endif  //DML_DETAIL_COMMON_TYPES_HPP
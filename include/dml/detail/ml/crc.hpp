@@ -0,0 +1,25 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef DML_ML_CRC_HPP
+#define DML_ML_CRC_HPP
+
+#include <dml/detail/common/types.hpp>
+#include <dml/detail/ml/options.hpp>
+
+namespace dml::detail::ml
+{
+    /**
+     * @brief Returns CRC of two adjacent regions given CRC of the first one and CRC of the second one calculated with zero seed
+     */
+    [[nodiscard]] crc_value_t crc_combine(crc_value_t          crc_a,
+                                          crc_value_t          crc_b,
+                                          std::uint64_t        length_b,
+                                          std::uint32_t        polynomial,
+                                          crc_specific_options specific_options) noexcept;
+}  // namespace dml::detail::ml
+
+#endif  //DML_ML_CRC_HPP
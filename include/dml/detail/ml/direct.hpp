@@ -0,0 +1,49 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef DML_ML_DIRECT_HPP
+#define DML_ML_DIRECT_HPP
+
+#include <dml/detail/common/types.hpp>
+#include <dml/detail/ml/options.hpp>
+#include <dml/detail/ml/view.hpp>
+
+/**
+ * Direct calls of the software kernels for small operations.
+ *
+ * Building, validating and dispatching a descriptor costs about as much as copying a few hundred bytes, so operations
+ * that software finishes in a single kernel call skip it. Arguments are expected to pass the checks below.
+ */
+namespace dml::detail::ml::direct
+{
+    /**
+     * @brief Largest transfer executed directly, larger ones are split between threads or use streaming stores
+     */
+    constexpr transfer_size_t max_transfer_size = 4095u;
+
+    /**
+     * @brief Checks that an operation with these arguments can be executed directly
+     */
+    template <typename size_type, typename... pointer_types>
+    [[nodiscard]] constexpr bool is_applicable(size_type size, const pointer_types*... pointers) noexcept
+    {
+        // Zero size wraps around and is rejected as well
+        return (static_cast<size_type>(size - 1u) < max_transfer_size) && ((pointers != nullptr) && ...);
+    }
+
+    void mem_move(const byte_t* src, byte_t* dst, transfer_size_t size) noexcept;
+
+    void fill(pattern_t pattern, byte_t* dst, transfer_size_t size) noexcept;
+
+    [[nodiscard]] crc_value_t crc(const byte_t* src, transfer_size_t size, crc_value_t crc_seed, crc_specific_options specific_options) noexcept;
+
+    /**
+     * @brief Writes successful completion of a directly executed operation to the task, so it can be waited for as a submitted one
+     */
+    void complete(task_view task, crc_value_t crc_value = 0u) noexcept;
+}  // namespace dml::detail::ml::direct
+
+#endif  //DML_ML_DIRECT_HPP
@@ -46,15 +46,15 @@ namespace dml::detail::ml
         }
 
         // Busy polling
-        execution_path_t::wait(view.get_descriptor(), false);
+        execution_path_t::wait(view.get_descriptor(), wait_mode::busy_poll);
 
         return statuses;
     }
 
     template <typename execution_path_t, typename task_view_t>
-    static void wait(task_view_t view, bool umwait = false) noexcept
+    static void wait(task_view_t view, wait_mode mode = wait_mode::busy_poll) noexcept
     {
-        execution_path_t::wait(view.get_descriptor(), umwait);
+        execution_path_t::wait(view.get_descriptor(), mode);
     }
 
     template <typename execution_path_t, typename task_view_t>
@@ -0,0 +1,75 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef DML_ML_WAIT_HPP
+#define DML_ML_WAIT_HPP
+
+#include <dml/detail/common/types.hpp>
+
+namespace dml::detail::ml
+{
+    /**
+     * @brief Lets the thread rest between two scans over completion records of many operations
+     *
+     * @param record Completion record whose write ends the rest early
+     * @param mode   Wait mode requested by the user
+     * @param scan   Number of scans done so far, adaptive mode rests longer as it grows
+     */
+    void rest_between_scans(completion_record& record, wait_mode mode, std::uint32_t scan) noexcept;
+
+    /**
+     * @brief Scans the operations until one of them is finished
+     *
+     * @param count    Number of operations, must not be zero
+     * @param mode     Wait mode
+     * @param finished Callable telling whether the operation with the given index is finished
+     * @param record   Callable returning the completion record of the operation with the given index
+     *
+     * @return Index of the first finished operation
+     */
+    template <typename finished_t, typename record_t>
+    size_t wait_any(size_t count, wait_mode mode, finished_t&& finished, record_t&& record) noexcept
+    {
+        for (std::uint32_t scan = 0u;; ++scan)
+        {
+            for (size_t index = 0u; index < count; ++index)
+            {
+                if (finished(index))
+                {
+                    return index;
+                }
+            }
+
+            // Operations are usually submitted to the same queue, so the first one tends to finish first
+            rest_between_scans(record(0u), mode, scan);
+        }
+    }
+
+    /**
+     * @brief Waits for all the operations to finish
+     *
+     * Every operation has to be waited for anyway, so they are waited for one by one in submission order.
+     * By the time the first one finishes, the ones submitted after it are likely finished too.
+     *
+     * @param count    Number of operations
+     * @param mode     Wait mode
+     * @param finished Callable telling whether the operation with the given index is finished
+     * @param record   Callable returning the completion record of the operation with the given index
+     */
+    template <typename finished_t, typename record_t>
+    void wait_all(size_t count, wait_mode mode, finished_t&& finished, record_t&& record) noexcept
+    {
+        for (size_t index = 0u; index < count; ++index)
+        {
+            for (std::uint32_t scan = 0u; !finished(index); ++scan)
+            {
+                rest_between_scans(record(index), mode, scan);
+            }
+        }
+    }
+}  // namespace dml::detail::ml
+
+#endif  //DML_ML_WAIT_HPP
@@ -165,6 +165,143 @@ dml_status_t dml_wait_job(dml_job_t *dml_job_ptr, dml_wait_mode_t wait_mode);
  */
 dml_status_t dml_check_job(dml_job_t *dml_job_ptr);
 
+/**
+ * @brief Waits until any of the submitted @ref dml_job_t structures is completed.
+ * (All jobs are checked in one loop, the calling thread rests between the scans according to the wait mode)
+ *
+ * @param[in,out] dml_jobs_ptr   Array of pointers to the submitted @ref dml_job_t structures
+ * @param[in]     jobs_count     Number of jobs in the array
+ * @param[in]     wait_mode      Type of waiting
+ * @param[out]    job_index_ptr  Index of the completed job
+ *
+ * @return Status of the completed job
+ * Return values:
+ * - @ref DML_STATUS_OK
+ * - @ref DML_STATUS_NULL_POINTER_ERROR
+ * - @ref DML_STATUS_LIMITS_ERROR if jobs_count is zero
+ * - or other status depending on the DML operation in the completed @ref dml_job_t
+ *
+ */
+dml_status_t dml_wait_any(dml_job_t **dml_jobs_ptr, uint32_t jobs_count, dml_wait_mode_t wait_mode, uint32_t *job_index_ptr);
+
+/**
+ * @brief Waits until all of the submitted @ref dml_job_t structures are completed.
+ *
+ * @param[in,out] dml_jobs_ptr   Array of pointers to the submitted @ref dml_job_t structures
+ * @param[in]     jobs_count     Number of jobs in the array
+ * @param[in]     wait_mode      Type of waiting
+ *
+ * @return @ref DML_STATUS_OK if all jobs succeeded, or status of the first failed job otherwise
+ * Return values:
+ * - @ref DML_STATUS_OK
+ * - @ref DML_STATUS_NULL_POINTER_ERROR
+ * - or other status depending on the DML operation in the failed @ref dml_job_t
+ *
+ */
+dml_status_t dml_wait_all(dml_job_t **dml_jobs_ptr, uint32_t jobs_count, dml_wait_mode_t wait_mode);
+
+/**
+ * @brief Checks the status of many @ref dml_job_t structures at once.
+ * (Results of the completed jobs are written to them, as by @ref dml_check_job)
+ *
+ * @param[in,out] dml_jobs_ptr         Array of pointers to the submitted @ref dml_job_t structures
+ * @param[in]     jobs_count           Number of jobs in the array
+ * @param[out]    completion_mask_ptr  Bit mask of the completed jobs, (jobs_count + 63) / 64 words long
+ *
+ * @return @ref DML_STATUS_OK in case of success execution, or non-zero value otherwise
+ * Return values:
+ * - @ref DML_STATUS_OK
+ * - @ref DML_STATUS_NULL_POINTER_ERROR
+ *
+ */
+dml_status_t dml_check_many(dml_job_t **dml_jobs_ptr, uint32_t jobs_count, uint64_t *completion_mask_ptr);
+
+/**
+ * @brief Initializes a completion queue over the memory provided by the application.
+ *
+ * @param[out] queue_ptr    Pointer to the @ref dml_completion_queue_t structure
+ * @param[in]  entries_ptr  Array of entries for outstanding jobs, must live as long as the queue
+ * @param[in]  capacity     Number of entries in the array, that is maximal number of outstanding jobs
+ *
+ * @return @ref DML_STATUS_OK in case of success execution, or non-zero value otherwise
+ * Return values:
+ * - @ref DML_STATUS_OK
+ * - @ref DML_STATUS_NULL_POINTER_ERROR
+ * - @ref DML_STATUS_LIMITS_ERROR if capacity is zero
+ *
+ */
+dml_status_t dml_init_completion_queue(dml_completion_queue_t *queue_ptr, dml_completion_entry_t *entries_ptr, uint32_t capacity);
+
+/**
+ * @brief Submits @ref dml_job_t and tracks it in the completion queue.
+ * (The job is returned by @ref dml_reap_completions together with user_data once it is completed)
+ *
+ * @param[in,out] queue_ptr    Pointer to the initialized @ref dml_completion_queue_t structure
+ * @param[in,out] dml_job_ptr  Pointer to the initialized @ref dml_job_t structure
+ * @param[in]     user_data    Value identifying the job to the application
+ *
+ * @return @ref DML_STATUS_OK in case of success execution, or non-zero value otherwise
+ * Return values:
+ * - @ref DML_STATUS_OK
+ * - @ref DML_STATUS_NULL_POINTER_ERROR
+ * - @ref DML_STATUS_LIMITS_ERROR if the queue is full
+ * - or other status of @ref dml_submit_job, the job is not tracked in this case
+ *
+ */
+dml_status_t dml_submit_job_to_queue(dml_completion_queue_t *queue_ptr, dml_job_t *dml_job_ptr, uint64_t user_data);
+
+/**
+ * @brief Takes completed jobs out of the completion queue.
+ * (Jobs are taken in submission order, a completed job waits for the ones submitted before it,
+ * and taken jobs get their results written as by @ref dml_check_job)
+ *
+ * @param[in,out] queue_ptr         Pointer to the initialized @ref dml_completion_queue_t structure
+ * @param[out]    completions_ptr   Array for at least max_count completed entries, with the status of every job
+ * @param[in]     min_count         Number of completed jobs to wait for, zero only checks the queue
+ * @param[in]     max_count         Maximal number of completed jobs to take
+ * @param[in]     wait_mode         Type of waiting, if min_count is not zero
+ * @param[out]    reaped_count_ptr  Number of completed jobs taken
+ *
+ * @return @ref DML_STATUS_OK in case of success execution, or non-zero value otherwise
+ * Return values:
+ * - @ref DML_STATUS_OK
+ * - @ref DML_STATUS_NULL_POINTER_ERROR
+ * - @ref DML_STATUS_LIMITS_ERROR if min_count exceeds max_count or number of outstanding jobs
+ *
+ */
+dml_status_t dml_reap_completions(dml_completion_queue_t *queue_ptr,
+                                  dml_completion_entry_t *completions_ptr,
+                                  uint32_t                min_count,
+                                  uint32_t                max_count,
+                                  dml_wait_mode_t         wait_mode,
+                                  uint32_t               *reaped_count_ptr);
+
+/**
+ * @brief Calculates CRC of two adjacent memory regions from CRC values of each of them, without reading the data.
+ *
+ * Lets a large region be hashed in chunks by several jobs at once, or a CRC be extended with appended data.
+ * The result is equal to CRC of the first region followed by the second one with the seed of the first region.
+ *
+ * @param[in]  crc_a         CRC value of the first region
+ * @param[in]  crc_b         CRC value of the second region calculated with zero seed
+ * @param[in]  length_b      Size of the second region in bytes
+ * @param[in]  polynomial    CRC polynomial without the highest term, 0x1EDC6F41 for the @ref DML_OP_CRC operation
+ * @param[in]  flags         CRC flags both values were calculated with, only @ref DML_FLAG_CRC_BYPASS_REFLECTION matters
+ * @param[out] crc_ptr       CRC value of the concatenated regions
+ *
+ * @return @ref DML_STATUS_OK in case of success execution, or non-zero value, otherwise
+ * Return values:
+ *      - @ref DML_STATUS_OK
+ *      - @ref DML_STATUS_NULL_POINTER_ERROR
+ *
+ */
+dml_status_t dml_crc_combine(uint32_t              crc_a,
+                             uint32_t              crc_b,
+                             uint64_t              length_b,
+                             uint32_t              polynomial,
+                             dml_operation_flags_t flags,
+                             uint32_t             *crc_ptr);
+
 /**
  * @brief The service function that returns the number of bytes to initialize a batch.
  *
@@ -324,6 +461,31 @@ dml_status_t dml_batch_set_crc_by_index(dml_job_t            *dml_job_ptr,
                                         uint32_t             *crc_seed_ptr,
                                         dml_operation_flags_t flags);
 
+/**
+ * @brief The service function that sets consecutive tasks for the @ref DML_OP_CRC operation, one per memory region.
+ *
+ * Independent regions set this way are hashed in parallel: the hardware path processes them in a single batch
+ * submission and the software path interleaves them in SIMD registers. Use @ref dml_batch_get_crc to read the results.
+ *
+ * @param[in]  dml_job_ptr         Pointer to the initialized @ref dml_job_t structure
+ * @param[in]  first_task_index    Index of the batch task for the first region
+ * @param[in]  buffers_ptr         Array of regions with their initial crc values
+ * @param[in]  buffers_count       Number of elements in the buffers_ptr array
+ * @param[in]  flags               Specific operation flags
+ *
+ * @return @ref DML_STATUS_OK in case of success execution, or non-zero value, otherwise
+ * Return values:
+ *      - @ref DML_STATUS_OK
+ *      - @ref DML_STATUS_NULL_POINTER_ERROR
+ *      - @ref DML_STATUS_BATCH_TASK_INDEX_OVERFLOW
+ *
+ */
+dml_status_t dml_batch_set_crc_buffers(dml_job_t              *dml_job_ptr,
+                                       uint32_t                first_task_index,
+                                       const dml_crc_buffer_t *buffers_ptr,
+                                       uint32_t                buffers_count,
+                                       dml_operation_flags_t   flags);
+
 /**
  * @brief The service function that sets the specific task for the @ref DML_OP_COPY_CRC operation.
  *
@@ -592,6 +754,23 @@ dml_status_t dml_batch_get_result(const dml_job_t *dml_job_ptr, uint32_t task_in
  */
 dml_status_t dml_batch_get_status(const dml_job_t *dml_job_ptr, uint32_t task_index, dml_status_t *status_ptr);
 
+/**
+ * @brief The service function that gets an access to the crc value calculated by a @ref DML_OP_CRC or
+ * @ref DML_OP_COPY_CRC task.
+ *
+ * @param[in]  dml_job_ptr    Pointer to the initialized @ref dml_job_t structure
+ * @param[in]  task_index     Index of the desired batch task
+ * @param[out] crc_ptr        Output buffer
+ *
+ * @return @ref DML_STATUS_OK in case of success execution, or non-zero value, otherwise
+ * Return values:
+ *      - @ref DML_STATUS_OK
+ *      - @ref DML_STATUS_NULL_POINTER_ERROR
+ *      - @ref DML_STATUS_BATCH_TASK_INDEX_OVERFLOW
+ *
+ */
+dml_status_t dml_batch_get_crc(const dml_job_t *dml_job_ptr, uint32_t task_index, uint32_t *crc_ptr);
+
 #ifdef __cplusplus
 }
 #endif
@@ -45,12 +45,15 @@ namespace dml
 {
 }
 
+#include <dml/hl/crc.hpp>
 #include <dml/hl/data_view.hpp>
 #include <dml/hl/execute.hpp>
 #include <dml/hl/execution_interface.hpp>
 #include <dml/hl/execution_path.hpp>
+#include <dml/hl/handler_group.hpp>
 #include <dml/hl/operations.hpp>
 #include <dml/hl/sequence.hpp>
 #include <dml/hl/submit.hpp>
+#include <dml/hl/work_stealing_executor.hpp>
 
 #endif  //DML_DML_HPP
@@ -55,6 +55,10 @@ extern "C" {
 
 #define DML_MIN_BATCH_SIZE (4u)                     /**< Minimum batch size for bulk operations */
 
+#define DML_NUMA_ID_CURRENT ( DML_MAX_32U )         /**< Submit to a device on the NUMA node of the submitting thread */
+#define DML_NUMA_ID_DATA    ( DML_MAX_32U - 1u )    /**< Submit to a device on the NUMA node of the destination memory,
+                                                         or of the source memory for operations that only read it */
+
 /* ====== DML Macros ====== */
 #define DML_MAX(a, b) ( ((a) > (b)) ? (a) : (b) )   /**< Simple macro to find maximum between pair values */
 #define DML_MIN(a, b) ( ((a) < (b)) ? (a) : (b) )   /**< Simple macro to find minimum between pair values */
@@ -230,6 +234,7 @@ typedef enum
 {
   DML_WAIT_MODE_BUSY_POLL = 0x0u, /**< Enables busy polling for completion    */
   DML_WAIT_MODE_UMWAIT    = 0x1u, /**< Enables umonitor/umwait for completion */
+  DML_WAIT_MODE_ADAPTIVE  = 0x2u, /**< Spins, sleeps with umwait for the expected job duration, then yields the core */
 } dml_wait_mode_t;
 
 /**
@@ -367,6 +372,17 @@ typedef struct
 } dml_dif_config_t;
 
 
+/**
+ * @brief Describes one of independent memory regions for the @ref dml_batch_set_crc_buffers function.
+ */
+typedef struct
+{
+    uint8_t  *source_ptr;  /**< Memory region for the operation */
+    uint32_t  byte_length; /**< Number of bytes to proceed      */
+    uint32_t  crc_seed;    /**< Initial crc value               */
+} dml_crc_buffer_t;
+
+
 /**
  * @brief Primary structure in the DML Job API to specify DML operation and this context.
  */
@@ -386,11 +402,36 @@ typedef struct
     dml_meta_result_t      expected_result;        /**< Expected result for some operations                         */
     dml_operation_flags_t  flags;                  /**< Auxiliary DML operation flags - see below                   */
     dml_dif_config_t       dif_config;             /**< Properties for DIF operations                               */
-    uint32_t               numa_id;                /**< NUMA node id for submission                                 */
+    uint32_t               numa_id;                /**< NUMA node id for submission, see @ref DML_NUMA_ID_DATA      */
     dml_internal_data_t   *internal_data_ptr;      /**< Internal memory buffers & structures for all DML operations */
 } dml_job_t;
 
 
+/**
+ * @brief Job in a @ref dml_completion_queue_t together with a value identifying it to the application.
+ */
+typedef struct
+{
+    dml_job_t    *job_ptr;   /**< Submitted job                                        */
+    uint64_t      user_data; /**< Value passed on submission, returned with completion */
+    dml_status_t  status;    /**< Status of the completed job                          */
+} dml_completion_entry_t;
+
+
+/**
+ * @brief Completion queue, keeps submitted jobs in submission order until they are reaped.
+ *
+ * @note Initialized with @ref dml_init_completion_queue, fields are not to be changed by the application.
+ */
+typedef struct
+{
+    dml_completion_entry_t *entries_ptr; /**< Ring of outstanding jobs, provided by the application */
+    uint32_t                capacity;    /**< Number of entries in the ring                         */
+    uint32_t                head;        /**< Position of the oldest outstanding job                */
+    uint32_t                count;       /**< Number of outstanding jobs                            */
+} dml_completion_queue_t;
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,137 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @date 10/18/2026
+ * @brief Contains @ref crc_combine and @ref parallel_crc definitions
+ */
+
+#ifndef DML_HL_CRC_HPP
+#define DML_HL_CRC_HPP
+
+#include <algorithm>
+#include <vector>
+
+#include <dml/detail/ml/crc.hpp>
+#include <dml/hl/data_view.hpp>
+#include <dml/hl/execute.hpp>
+#include <dml/hl/operations.hpp>
+#include <dml/hl/result.hpp>
+#include <dml/hl/submit.hpp>
+
+namespace dml
+{
+    /**
+     * @ingroup dmlhl_aux
+     * @brief Calculates CRC of two adjacent memory regions from CRC values of each of them, without reading the data
+     *
+     * The result is equal to CRC of the first region followed by the second one with the seed of the first region.
+     * Takes time logarithmic in length_b.
+     *
+     * @param operation  Instance of @ref crc_operation both CRC values were calculated with
+     * @param crc_a      CRC value of the first region
+     * @param crc_b      CRC value of the second region calculated with zero seed
+     * @param length_b   Size of the second region in bytes
+     * @param polynomial CRC polynomial without the highest term
+     *
+     * Usage:
+     * @code
+     * auto crc = dml::crc_combine(dml::crc, head_result.crc_value, tail_result.crc_value, tail_size);
+     * @endcode
+     *
+     * @return CRC value of the concatenated regions
+     */
+    [[nodiscard]] inline uint32_t crc_combine(crc_operation operation,
+                                              uint32_t      crc_a,
+                                              uint32_t      crc_b,
+                                              std::uint64_t length_b,
+                                              uint32_t      polynomial = 0x1EDC6F41u) noexcept
+    {
+        return detail::ml::crc_combine(crc_a, crc_b, length_b, polynomial, operation.get_specific_options());
+    }
+
+    /**
+     * @ingroup dmlhl_execute
+     * @brief Executes CRC operation on a memory region split into chunks, which are processed concurrently
+     *
+     * Every chunk is submitted as a separate operation and CRC values of the chunks are merged with @ref crc_combine.
+     * On the hardware path the chunks are spread over the available devices.
+     *
+     * @tparam execution_path Type of @ref dmlhl_aux_path
+     * @param operation       Instance of @ref crc_operation
+     * @param src_view        @ref data_view to the source memory region
+     * @param crc_seed        Initial CRC value
+     * @param chunk_count     Maximal number of chunks
+     * @param numa_id         Custom numa id for submission, @ref numa_id_current or @ref numa_id_data
+     *
+     * Usage:
+     * @code
+     * auto result = dml::parallel_crc<dml::hardware>(dml::crc, dml::make_view(src), crc_seed, 8u);
+     * @endcode
+     *
+     * @return @ref crc_result
+     */
+    template <typename execution_path>
+    auto parallel_crc(crc_operation   operation,
+                      const_data_view src_view,
+                      uint32_t        crc_seed,
+                      size_t          chunk_count,
+                      std::uint32_t   numa_id = std::numeric_limits<std::uint32_t>::max())
+    {
+        // Chunks are whole cache lines, so concurrent operations do not share any
+        constexpr size_t cache_line_size = 64u;
+
+        const auto chunk_size = (src_view.size() / std::max(chunk_count, size_t(1u)) + cache_line_size - 1u) & ~(cache_line_size - 1u);
+
+        if (chunk_size == 0u || chunk_size >= src_view.size())
+        {
+            return execute<execution_path>(operation, src_view, crc_seed, numa_id);
+        }
+
+        using handler_t = decltype(submit<execution_path>(operation, src_view, crc_seed));
+
+        std::vector<handler_t> handlers;
+        handlers.reserve((src_view.size() + chunk_size - 1u) / chunk_size);
+
+        for (size_t offset = 0u; offset < src_view.size(); offset += chunk_size)
+        {
+            const auto size = std::min(chunk_size, src_view.size() - offset);
+
+            handlers.push_back(submit<execution_path>(operation,
+                                                      make_view(src_view.data() + offset, size),
+                                                      (offset == 0u) ? crc_seed : 0u,
+                                                      default_execution_interface<execution_path>(),
+                                                      numa_id));
+        }
+
+        auto result = crc_result{ status_code::ok, 0u };
+
+        // Every handler is waited for, even after a failure, so no operation outlives its memory
+        for (size_t chunk = 0u; chunk < handlers.size(); ++chunk)
+        {
+            const auto chunk_result = handlers[chunk].get();
+
+            if (chunk_result.status != status_code::ok)
+            {
+                result.status = (result.status == status_code::ok) ? chunk_result.status : result.status;
+            }
+            else if (chunk == 0u)
+            {
+                result.crc_value = chunk_result.crc_value;
+            }
+            else
+            {
+                const auto size = std::min(chunk_size, src_view.size() - static_cast<size_t>(chunk * chunk_size));
+
+                result.crc_value = crc_combine(operation, result.crc_value, chunk_result.crc_value, size);
+            }
+        }
+
+        return result;
+    }
+}  // namespace dml
+
+#endif  //DML_HL_CRC_HPP
@@ -12,6 +12,7 @@
 #ifndef DML_DETAIL_EXECUTE_HPP
 #define DML_DETAIL_EXECUTE_HPP
 
+#include <dml/detail/ml/direct.hpp>
 #include <dml/detail/ml/result.hpp>
 #include <dml/detail/ml/view.hpp>
 #include <dml/hl/detail/utils.hpp>
@@ -22,6 +23,14 @@
 
 namespace dml::detail
 {
+    /**
+     * @brief Tells whether small operations on the execution path are done by direct kernel calls
+     *
+     * @tparam execution_path_t Type of execution path
+     */
+    template <typename execution_path_t>
+    constexpr bool is_direct_call_path = std::is_same_v<typename execution_path_t::execution_path, ml::execution_path::software>;
+
     /**
      * @brief Provides common execute implementation
      *
@@ -0,0 +1,282 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @date 10/18/2023
+ * @brief Contains thread pool behind @ref work_stealing_executor
+ */
+
+#ifndef DML_DETAIL_WORK_STEALING_POOL_HPP
+#define DML_DETAIL_WORK_STEALING_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace dml::detail
+{
+    /**
+     * @brief Move-only type-erased callable with no arguments
+     */
+    class executor_task
+    {
+        struct callable
+        {
+            virtual ~callable() = default;
+
+            virtual void operator()() = 0;
+        };
+
+        template <typename task_t>
+        struct callable_impl final : callable
+        {
+            explicit callable_impl(task_t &&some_task): task(std::move(some_task))
+            {
+            }
+
+            void operator()() override
+            {
+                task();
+            }
+
+            task_t task;
+        };
+
+    public:
+        executor_task() noexcept = default;
+
+        template <typename task_t, typename = std::enable_if_t<!std::is_same_v<std::decay_t<task_t>, executor_task>>>
+        explicit executor_task(task_t &&task):
+            impl_(std::make_unique<callable_impl<std::decay_t<task_t>>>(std::decay_t<task_t>(std::forward<task_t>(task))))
+        {
+        }
+
+        void operator()()
+        {
+            (*impl_)();
+        }
+
+    private:
+        std::unique_ptr<callable> impl_; /**< Erased task */
+    };
+
+    /**
+     * @brief Pool of threads with a bounded task queue per thread
+     */
+    class work_stealing_pool
+    {
+        struct worker_queue
+        {
+            std::mutex                guard;
+            std::deque<executor_task> tasks;
+        };
+
+        struct worker_context
+        {
+            const work_stealing_pool *pool  = nullptr;
+            size_t                    index = 0u;
+        };
+
+    public:
+        work_stealing_pool(std::uint32_t thread_count, std::uint32_t queue_capacity, std::vector<std::uint32_t> cpus):
+            capacity_(queue_capacity != 0u ? queue_capacity : 1u)
+        {
+            const auto count = thread_count != 0u ? thread_count : 1u;
+
+            // All queues must exist before the first worker starts stealing
+            for (auto i = 0u; i < count; ++i)
+            {
+                queues_.push_back(std::make_unique<worker_queue>());
+            }
+
+            for (auto i = 0u; i < count; ++i)
+            {
+                workers_.emplace_back(&work_stealing_pool::process, this, size_t(i));
+
+#if defined(__linux__)
+                if (!cpus.empty())
+                {
+                    cpu_set_t cpu_set;
+                    CPU_ZERO(&cpu_set);
+                    CPU_SET(cpus[i % cpus.size()], &cpu_set);
+
+                    // Pinning is best effort, an unpinned worker is still usable
+                    static_cast<void>(pthread_setaffinity_np(workers_.back().native_handle(), sizeof(cpu_set), &cpu_set));
+                }
+#else
+                static_cast<void>(cpus);
+#endif
+            }
+        }
+
+        work_stealing_pool(const work_stealing_pool &) = delete;
+
+        work_stealing_pool &operator=(const work_stealing_pool &) = delete;
+
+        ~work_stealing_pool() noexcept
+        {
+            stop_requested_.store(true);
+
+            {
+                std::lock_guard<std::mutex> lock(sleep_guard_);
+            }
+            wakeup_.notify_all();
+
+            for (auto &worker : workers_)
+            {
+                worker.join();
+            }
+        }
+
+        void push(executor_task &&task)
+        {
+            const auto  count   = queues_.size();
+            const auto &context = current_worker();
+            const auto  first   = (context.pool == this) ? context.index
+                                                         : next_queue_.fetch_add(1u, std::memory_order_relaxed) % count;
+
+            for (size_t i = 0u; i < count; ++i)
+            {
+                auto &queue = *queues_[(first + i) % count];
+
+                std::unique_lock<std::mutex> lock(queue.guard);
+
+                if (queue.tasks.size() < capacity_)
+                {
+                    queue.tasks.push_back(std::move(task));
+                    pending_.fetch_add(1u);
+                    lock.unlock();
+
+                    wake_one();
+
+                    return;
+                }
+            }
+
+            // Every queue is full, run in the calling thread to apply backpressure
+            task();
+        }
+
+        [[nodiscard]] std::uint32_t thread_count() const noexcept
+        {
+            return static_cast<std::uint32_t>(workers_.size());
+        }
+
+    private:
+        static worker_context &current_worker() noexcept
+        {
+            static thread_local worker_context context{};
+
+            return context;
+        }
+
+        void wake_one()
+        {
+            // Pairs with the sleeping counter increment in process(): either the worker sees
+            // the pending task before it sleeps or we see the worker sleeping and wake it up
+            if (sleeping_.load() != 0u)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(sleep_guard_);
+                }
+                wakeup_.notify_one();
+            }
+        }
+
+        bool try_take(size_t index, executor_task &task)
+        {
+            const auto count = queues_.size();
+
+            // Own queue is served newest first as its data is most likely still in cache
+            {
+                auto &queue = *queues_[index];
+
+                std::lock_guard<std::mutex> lock(queue.guard);
+
+                if (!queue.tasks.empty())
+                {
+                    task = std::move(queue.tasks.back());
+                    queue.tasks.pop_back();
+                    pending_.fetch_sub(1u);
+
+                    return true;
+                }
+            }
+
+            // Other queues are robbed oldest first
+            for (size_t i = 1u; i < count; ++i)
+            {
+                auto &queue = *queues_[(index + i) % count];
+
+                std::lock_guard<std::mutex> lock(queue.guard);
+
+                if (!queue.tasks.empty())
+                {
+                    task = std::move(queue.tasks.front());
+                    queue.tasks.pop_front();
+                    pending_.fetch_sub(1u);
+
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        void process(size_t index)
+        {
+            current_worker() = worker_context{this, index};
+
+            auto task = executor_task();
+
+            while (true)
+            {
+                if (try_take(index, task))
+                {
+                    task();
+                    task = executor_task();
+
+                    continue;
+                }
+
+                if (stop_requested_.load() && pending_.load() == 0u)
+                {
+                    return;
+                }
+
+                std::unique_lock<std::mutex> lock(sleep_guard_);
+                sleeping_.fetch_add(1u);
+                wakeup_.wait(lock, [this]() { return pending_.load() != 0u || stop_requested_.load(); });
+                sleeping_.fetch_sub(1u);
+            }
+        }
+
+    private:
+        const size_t                               capacity_;            /**< Capacity of each queue */
+        std::vector<std::unique_ptr<worker_queue>> queues_;              /**< Queue per worker */
+        std::vector<std::thread>                   workers_;             /**< Worker threads */
+        std::atomic<size_t>                        next_queue_{0u};      /**< Round-robin cursor for external pushes */
+        std::atomic<size_t>                        pending_{0u};         /**< Number of queued tasks */
+        std::atomic<std::uint32_t>                 sleeping_{0u};        /**< Number of sleeping workers */
+        std::atomic<bool>                          stop_requested_{false};
+        std::mutex                                 sleep_guard_;
+        std::condition_variable                    wakeup_;
+    };
+}  // namespace dml::detail
+
+#endif  //DML_DETAIL_WORK_STEALING_POOL_HPP
@@ -12,6 +12,8 @@
 #ifndef DML_EXECUTE_HPP
 #define DML_EXECUTE_HPP
 
+#include <algorithm>
+
 #include <dml/detail/ml/make_task.hpp>
 #include <dml/hl/detail/execute.hpp>
 #include <dml/hl/detail/utils.hpp>
@@ -35,7 +37,7 @@ namespace dml
      * @tparam sequence_allocator_t Type of @ref sequence allocator
      * @param operation             Instance of @ref batch_operation
      * @param seq                   Instance of @ref sequence filled with operations
-     * @param numa_id               Custom numa id for submission
+     * @param numa_id               Custom numa id for submission, @ref numa_id_current or @ref numa_id_data
      *
      * Usage (software execution path):
      * @code
@@ -68,7 +70,7 @@ namespace dml
      *
      * @tparam execution_path Type of @ref dmlhl_aux_path
      * @param operation       Instance of @ref nop_operation
-     * @param numa_id         Custom numa id for submission
+     * @param numa_id         Custom numa id for submission, @ref numa_id_current or @ref numa_id_data
      *
      * Usage (software execution path):
      * @code
@@ -102,7 +104,7 @@ namespace dml
      * @param operation       Instance of @ref mem_move_operation
      * @param src_view        @ref data_view to the source memory region
      * @param dst_view        @ref data_view to the destination memory region
-     * @param numa_id         Custom numa id for submission
+     * @param numa_id         Custom numa id for submission, @ref numa_id_current or @ref numa_id_data
      *
      * Usage (software execution path):
      * @code
@@ -121,6 +123,15 @@ namespace dml
                         data_view dst_view,
                         std::uint32_t numa_id = std::numeric_limits<std::uint32_t>::max()) noexcept
     {
+        if constexpr (detail::is_direct_call_path<execution_path>)
+        {
+            if (src_view.size() == dst_view.size() && detail::ml::direct::is_applicable(src_view.size(), src_view.data(), dst_view.data()))
+            {
+                detail::ml::direct::mem_move(src_view.data(), dst_view.data(), static_cast<detail::transfer_size_t>(src_view.size()));
+                return mem_move_result{ status_code::ok };
+            }
+        }
+
         return detail::execute<execution_path, mem_move_operation>(
             numa_id,
             [&]
@@ -143,7 +154,7 @@ namespace dml
      * @param operation       Instance of @ref mem_copy_operation
      * @param src_view        @ref data_view to the source memory region
      * @param dst_view        @ref data_view to the destination memory region
-     * @param numa_id         Custom numa id for submission
+     * @param numa_id         Custom numa id for submission, @ref numa_id_current or @ref numa_id_data
      *
      * Usage (software execution path):
      * @code
@@ -162,6 +173,15 @@ namespace dml
                         data_view dst_view,
                         std::uint32_t numa_id = std::numeric_limits<std::uint32_t>::max()) noexcept
     {
+        if constexpr (detail::is_direct_call_path<execution_path>)
+        {
+            if (src_view.size() == dst_view.size() && detail::ml::direct::is_applicable(src_view.size(), src_view.data(), dst_view.data()))
+            {
+                detail::ml::direct::mem_move(src_view.data(), dst_view.data(), static_cast<detail::transfer_size_t>(src_view.size()));
+                return mem_copy_result{ status_code::ok };
+            }
+        }
+
         return detail::execute<execution_path, mem_copy_operation>(
             numa_id,
             [&]
@@ -184,7 +204,7 @@ namespace dml
      * @param operation       Instance of @ref fill_operation
      * @param pattern         64-bit pattern used to fill the destination
      * @param dst_view        @ref data_view to the destination memory region
-     * @param numa_id         Custom numa id for submission
+     * @param numa_id         Custom numa id for submission, @ref numa_id_current or @ref numa_id_data
      *
      * Usage (software execution path):
      * @code
@@ -203,6 +223,15 @@ namespace dml
                  data_view dst_view,
                  std::uint32_t numa_id = std::numeric_limits<std::uint32_t>::max())
     {
+        if constexpr (detail::is_direct_call_path<execution_path>)
+        {
+            if (detail::ml::direct::is_applicable(dst_view.size(), dst_view.data()))
+            {
+                detail::ml::direct::fill(pattern, dst_view.data(), static_cast<detail::transfer_size_t>(dst_view.size()));
+                return fill_result{ status_code::ok };
+            }
+        }
+
         return detail::execute<execution_path, fill_operation>(
             numa_id,
             [&]
@@ -221,7 +250,7 @@ namespace dml
      * @param src_view        @ref data_view to the source memory region
      * @param dst1_view       @ref data_view to the first destination memory region
      * @param dst2_view       @ref data_view to the second destination memory region
-     * @param numa_id         Custom numa id for submission
+     * @param numa_id         Custom numa id for submission, @ref numa_id_current or @ref numa_id_data
      *
      * Usage (software execution path):
      * @code
@@ -269,7 +298,7 @@ namespace dml
      * @param operation       Instance of @ref compare_operation
      * @param src1_view       @ref data_view to the first source memory region
      * @param src2_view       @ref data_view to the second source memory region
-     * @param numa_id         Custom numa id for submission
+     * @param numa_id         Custom numa id for submission, @ref numa_id_current or @ref numa_id_data
      *
      * Usage (software execution path):
      * @code
@@ -314,7 +343,7 @@ namespace dml
      * @param operation       Instance of @ref compare_pattern_operation
      * @param pattern         64-bit pattern to compare with the memory region
      * @param src_view        @ref data_view to the source memory region
-     * @param numa_id         Custom numa id for submission
+     * @param numa_id         Custom numa id for submission, @ref numa_id_current or @ref numa_id_data
      *
      * Usage (software execution path):
      * @code
@@ -355,7 +384,7 @@ namespace dml
      * @param src1_view       @ref data_view to the first source memory region
      * @param src2_view       @ref data_view to the second source memory region
      * @param delta_view      @ref data_view to the memory region for delta record
-     * @param numa_id         Custom numa id for submission
+     * @param numa_id         Custom numa id for submission, @ref numa_id_current or @ref numa_id_data
      *
      * Usage (software execution path):
      * @code
@@ -404,7 +433,7 @@ namespace dml
      * @param delta_view      @ref data_view to the memory region with delta record
      * @param dst_view        @ref data_view to the destination memory region (the first source from Create Delta)
      * @param delta_result    Result from Create Delta operation
-     * @param numa_id         Custom numa id for submission
+     * @param numa_id         Custom numa id for submission, @ref numa_id_current or @ref numa_id_data
      *
      * Usage (software execution path):
      * @code
@@ -453,7 +482,7 @@ namespace dml
      * @param operation       Instance of @ref crc_operation
      * @param src_view        @ref data_view to the source memory region
      * @param crc_seed        Initial CRC value
-     * @param numa_id         Custom numa id for submission
+     * @param numa_id         Custom numa id for submission, @ref numa_id_current or @ref numa_id_data
      *
      * Usage (software execution path):
      * @code
@@ -472,6 +501,18 @@ namespace dml
                  uint32_t crc_seed,
                  std::uint32_t numa_id = std::numeric_limits<std::uint32_t>::max())
     {
+        if constexpr (detail::is_direct_call_path<execution_path>)
+        {
+            if (detail::ml::direct::is_applicable(src_view.size(), src_view.data()))
+            {
+                return crc_result{ status_code::ok,
+                                   detail::ml::direct::crc(src_view.data(),
+                                                           static_cast<detail::transfer_size_t>(src_view.size()),
+                                                           crc_seed,
+                                                           operation.get_specific_options()) };
+            }
+        }
+
         return detail::execute<execution_path, crc_operation>(
             numa_id,
             [&]
@@ -484,6 +525,69 @@ namespace dml
             });
     }
 
+    /**
+     * @brief Executes CRC operation on a number of independent memory regions on a specified execution path
+     *
+     * See @ref crc_operation for algorithm details. The regions are submitted as a single batch, so hardware
+     * processes them in one submission and software interleaves several of them in SIMD registers.
+     *
+     * @tparam execution_path Type of @ref dmlhl_aux_path
+     * @param operation       Instance of @ref crc_operation
+     * @param buffers         Array of @ref crc_buffer to calculate CRC of
+     * @param count           Number of elements in buffers
+     * @param crc_values      Array of count elements to store calculated CRC values
+     * @param numa_id         Custom numa id for submission, @ref numa_id_current or @ref numa_id_data
+     *
+     * Usage (software execution path):
+     * @code
+     * auto result = dml::execute<dml::software>(dml::crc, buffers.data(), buffers.size(), crc_values.data());
+     * @endcode
+     * Usage (hardware execution path):
+     * @code
+     * auto result = dml::execute<dml::hardware>(dml::crc, buffers.data(), buffers.size(), crc_values.data());
+     * @endcode
+     *
+     * @return @ref batch_result, crc_values are written only if the status is @ref status_code::ok
+     */
+    template <typename execution_path>
+    auto execute(crc_operation operation,
+                 const crc_buffer *buffers,
+                 size_t count,
+                 uint32_t *crc_values,
+                 std::uint32_t numa_id = std::numeric_limits<std::uint32_t>::max())
+    {
+        // Batches shorter than that are rejected, the rest is padded with no-ops
+        constexpr size_t min_batch_length = 4u;
+
+        auto seq = sequence<>(std::max(count, min_batch_length));
+
+        for (size_t i = 0u; i < count; ++i)
+        {
+            auto status = seq.add(operation, make_view(buffers[i].data, buffers[i].size), buffers[i].seed);
+            if (status != status_code::ok)
+            {
+                return batch_result{ status, 0u };
+            }
+        }
+
+        while (seq.length() < min_batch_length)
+        {
+            static_cast<void>(seq.add(nop));
+        }
+
+        auto result = execute<execution_path>(batch, seq, numa_id);
+
+        if (result.status == status_code::ok)
+        {
+            for (size_t i = 0u; i < count; ++i)
+            {
+                crc_values[i] = seq.crc_value(i);
+            }
+        }
+
+        return result;
+    }
+
     /**
      * @brief Executes Copy + CRC operation on a specified execution path
      *
@@ -494,7 +598,7 @@ namespace dml
      * @param src_view        @ref data_view to the source memory region
      * @param dst_view        @ref data_view to the destination memory region
      * @param crc_seed        Initial CRC value
-     * @param numa_id         Custom numa id for submission
+     * @param numa_id         Custom numa id for submission, @ref numa_id_current or @ref numa_id_data
      *
      * Usage (software execution path):
      * @code
@@ -540,7 +644,7 @@ namespace dml
      * @tparam execution_path Type of @ref dmlhl_aux_path
      * @param operation       Instance of @ref cache_flush_operation
      * @param dst_view        @ref data_view to the destination memory region
-     * @param numa_id         Custom numa id for submission
+     * @param numa_id         Custom numa id for submission, @ref numa_id_current or @ref numa_id_data
      *
      * Usage (software execution path):
      * @code
@@ -13,7 +13,7 @@
 #define DML_EXECUTION_PATH_HPP
 
 #include <dml/detail/ml/execution_path.hpp>
-#include <thread>
+#include <dml/hl/work_stealing_executor.hpp>
 
 namespace dml
 {
@@ -37,7 +37,7 @@ namespace dml
         struct default_thread_spawner
         {
             /**
-             * @brief Starts a task in a detached standard thread
+             * @brief Starts a task on the process-wide @ref work_stealing_executor
              *
              * @tparam task_t Type of callable task
              * @param task    Instance of a callable task
@@ -45,7 +45,17 @@ namespace dml
             template <typename task_t>
             void operator()(task_t &&task) const
             {
-                std::thread(std::forward<task_t>(task)).detach();
+                get_executor()(std::forward<task_t>(task));
+            }
+
+            /**
+             * @brief Returns executor shared by all default thread spawners, started on first use
+             */
+            static const work_stealing_executor &get_executor()
+            {
+                static const auto executor = work_stealing_executor();
+
+                return executor;
             }
         };
 
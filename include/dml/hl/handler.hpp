@@ -15,6 +15,7 @@
 #include <dml/detail/ml/result.hpp>
 #include <dml/detail/ml/task.hpp>
 #include <dml/hl/detail/handler.hpp>
+#include <dml/hl/types.hpp>
 
 namespace dml
 {
@@ -103,27 +104,30 @@ namespace dml
          *
          * In case handler is not valid, resulting structure status field will contain error status code.
          *
+         * @param mode How the thread waits, see @ref wait_mode
+         *
          * @return Result structure for an operation
          */
-        auto get() noexcept
+        auto get(wait_mode mode = wait_mode::busy_poll) noexcept
         {
             auto  task_view         = make_view(task_);
             auto &completion_record = task_view.get_completion_record();
+            auto  ml_mode           = static_cast<detail::wait_mode>(mode);
 
             if (status_ == status_code::ok)
             {
                 switch(path_){
                     case path_e::automatic_e:
-                        detail::ml::wait<detail::ml::execution_path::automatic>(task_view);
+                        detail::ml::wait<detail::ml::execution_path::automatic>(task_view, ml_mode);
                         break;
                     case path_e::software_e:
-                        detail::ml::wait<detail::ml::execution_path::software>(task_view);
+                        detail::ml::wait<detail::ml::execution_path::software>(task_view, ml_mode);
                         break;
                     case path_e::hardware_e:
-                        detail::ml::wait<detail::ml::execution_path::hardware>(task_view);
+                        detail::ml::wait<detail::ml::execution_path::hardware>(task_view, ml_mode);
                         break;
                     default:
-                        detail::ml::wait<detail::ml::execution_path::software>(task_view);
+                        detail::ml::wait<detail::ml::execution_path::software>(task_view, ml_mode);
                 }
 
                 return detail::make_result<result_type>(completion_record);
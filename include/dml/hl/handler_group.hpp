@@ -0,0 +1,134 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @date 10/18/2026
+ * @brief Contains @ref handler_group definition
+ */
+
+#ifndef DML_HL_HANDLER_GROUP_HPP
+#define DML_HL_HANDLER_GROUP_HPP
+
+#include <memory>
+#include <vector>
+
+#include <dml/detail/ml/wait.hpp>
+#include <dml/hl/handler.hpp>
+
+namespace dml
+{
+    /**
+     * @ingroup dmlhl_aux
+     * @brief Group of handlers, which are waited for together in a single polling loop
+     *
+     * Usage:
+     * @code
+     * auto group = dml::handler_group<dml::mem_move_operation>();
+     *
+     * group.add(dml::submit<dml::hardware>(dml::mem_move, dml::make_view(src0), dml::make_view(dst0)));
+     * group.add(dml::submit<dml::hardware>(dml::mem_move, dml::make_view(src1), dml::make_view(dst1)));
+     *
+     * auto index  = group.wait_any(dml::wait_mode::umwait);
+     * auto result = group[index].get();
+     * @endcode
+     *
+     * @tparam operation_t Type of operation
+     * @tparam allocator_t Type of allocator
+     */
+    template <typename operation_t, typename allocator_t = std::allocator<byte_t>>
+    class handler_group
+    {
+       public:
+        /**
+         * @brief Type of grouped handlers
+         */
+        using handler_type = handler<operation_t, allocator_t>;
+
+        /**
+         * @brief Adds a handler to the group
+         *
+         * @param op_handler Handler of a submitted operation
+         *
+         * @return Index of the handler in the group
+         */
+        size_t add(handler_type &&op_handler)
+        {
+            handlers_.push_back(std::move(op_handler));
+
+            return handlers_.size() - 1u;
+        }
+
+        /**
+         * @brief Returns number of handlers in the group
+         */
+        [[nodiscard]] size_t size() const noexcept
+        {
+            return handlers_.size();
+        }
+
+        /**
+         * @brief Returns handler with the given index
+         */
+        handler_type &operator[](size_t index) noexcept
+        {
+            return handlers_[index];
+        }
+
+        /**
+         * @brief Checks every handler in the group once
+         *
+         * @return Vector with true for every finished operation
+         */
+        [[nodiscard]] std::vector<bool> finished_mask()
+        {
+            auto mask = std::vector<bool>(handlers_.size());
+
+            for (size_t index = 0u; index < handlers_.size(); ++index)
+            {
+                mask[index] = handlers_[index].is_finished();
+            }
+
+            return mask;
+        }
+
+        /**
+         * @brief Waits until any of the operations is finished
+         *
+         * The group must not be empty. The result of the finished operation is taken with @ref handler::get.
+         *
+         * @param mode How the thread rests between the scans, see @ref wait_mode
+         *
+         * @return Index of the finished operation
+         */
+        size_t wait_any(wait_mode mode = wait_mode::busy_poll) noexcept
+        {
+            return detail::ml::wait_any(
+                handlers_.size(),
+                static_cast<detail::wait_mode>(mode),
+                [this](size_t index) { return handlers_[index].is_finished(); },
+                [this](size_t index) -> auto & { return detail::get_task_view(handlers_[index]).get_completion_record(); });
+        }
+
+        /**
+         * @brief Waits until all of the operations are finished
+         *
+         * @param mode How the thread rests between the scans, see @ref wait_mode
+         */
+        void wait_all(wait_mode mode = wait_mode::busy_poll) noexcept
+        {
+            detail::ml::wait_all(
+                handlers_.size(),
+                static_cast<detail::wait_mode>(mode),
+                [this](size_t index) { return handlers_[index].is_finished(); },
+                [this](size_t index) -> auto & { return detail::get_task_view(handlers_[index]).get_completion_record(); });
+        }
+
+       private:
+        std::vector<handler_type> handlers_; /**< Grouped handlers in submission order */
+    };
+}  // namespace dml
+
+#endif  //DML_HL_HANDLER_GROUP_HPP
@@ -78,6 +78,18 @@ namespace dml
             return &operations_.get(0);
         }
 
+        /**
+         * @brief Returns CRC value calculated by an executed CRC or Copy + CRC operation
+         *
+         * @param index Position of the operation in the sequence
+         *
+         * @return CRC value
+         */
+        [[nodiscard]] auto crc_value(size_t index) noexcept
+        {
+            return detail::ml::get_crc_value(results_.get(index));
+        }
+
         /**
          * @brief Adds No operation to the sequence
          *
@@ -41,7 +41,7 @@ namespace dml
      * @param operation              Instance of @ref batch_operation
      * @param seq                    Instance of @ref sequence filled with operations
      * @param executor               Instance of @ref execution_interface
-     * @param numa_id                Custom numa id for submission
+     * @param numa_id                Custom numa id for submission, @ref numa_id_current or @ref numa_id_data
      *
      * Usage (software execution path):
      * @code
@@ -90,7 +90,7 @@ namespace dml
      * @tparam execution_interface_t Type of @ref execution_interface
      * @param operation              Instance of @ref nop_operation
      * @param executor               Instance of @ref execution_interface
-     * @param numa_id                Custom numa id for submission
+     * @param numa_id                Custom numa id for submission, @ref numa_id_current or @ref numa_id_data
      *
      * Usage (software execution path):
      * @code
@@ -138,7 +138,7 @@ namespace dml
      * @param src_view               @ref data_view to the source memory region
      * @param dst_view               @ref data_view to the destination memory region
      * @param executor               Instance of @ref execution_interface
-     * @param numa_id                Custom numa id for submission
+     * @param numa_id                Custom numa id for submission, @ref numa_id_current or @ref numa_id_data
      *
      * Usage (software execution path):
      * @code
@@ -193,7 +193,7 @@ namespace dml
      * @param src_view               @ref data_view to the source memory region
      * @param dst_view               @ref data_view to the destination memory region
      * @param executor               Instance of @ref execution_interface
-     * @param numa_id                Custom numa id for submission
+     * @param numa_id                Custom numa id for submission, @ref numa_id_current or @ref numa_id_data
      *
      * Usage (software execution path):
      * @code
@@ -248,7 +248,7 @@ namespace dml
      * @param pattern                64-bit pattern used to fill the destination
      * @param dst_view               @ref data_view to the destination memory region
      * @param executor               Instance of @ref execution_interface
-     * @param numa_id                Custom numa id for submission
+     * @param numa_id                Custom numa id for submission, @ref numa_id_current or @ref numa_id_data
      *
      * Usage (software execution path):
      * @code
@@ -299,7 +299,7 @@ namespace dml
      * @param dst1_view              @ref data_view to the first destination memory region
      * @param dst2_view              @ref data_view to the second destination memory region
      * @param executor               Instance of @ref execution_interface
-     * @param numa_id                Custom numa id for submission
+     * @param numa_id                Custom numa id for submission, @ref numa_id_current or @ref numa_id_data
      *
      * Usage (software execution path):
      * @code
@@ -361,7 +361,7 @@ namespace dml
      * @param src1_view              @ref data_view to the first source memory region
      * @param src2_view              @ref data_view to the second source memory region
      * @param executor               Instance of @ref execution_interface
-     * @param numa_id                Custom numa id for submission
+     * @param numa_id                Custom numa id for submission, @ref numa_id_current or @ref numa_id_data
      *
      * Usage (software execution path):
      * @code
@@ -420,7 +420,7 @@ namespace dml
      * @param pattern                64-bit pattern to compare with the memory region
      * @param src_view               @ref data_view to the source memory region
      * @param executor               Instance of @ref execution_interface
-     * @param numa_id                Custom numa id for submission
+     * @param numa_id                Custom numa id for submission, @ref numa_id_current or @ref numa_id_data
      *
      * Usage (software execution path):
      * @code
@@ -475,7 +475,7 @@ namespace dml
      * @param src2_view              @ref data_view to the second source memory region
      * @param delta_view             @ref data_view to the memory region for delta record
      * @param executor               Instance of @ref execution_interface
-     * @param numa_id                Custom numa id for submission
+     * @param numa_id                Custom numa id for submission, @ref numa_id_current or @ref numa_id_data
      *
      * Usage (software execution path):
      * @code
@@ -538,7 +538,7 @@ namespace dml
      * @param dst_view               @ref data_view to the destination memory region (the first source from Create Delta)
      * @param delta_result           Result from Create Delta operation
      * @param executor               Instance of @ref execution_interface
-     * @param numa_id                Custom numa id for submission
+     * @param numa_id                Custom numa id for submission, @ref numa_id_current or @ref numa_id_data
      *
      * Usage (software execution path):
      * @code
@@ -601,7 +601,7 @@ namespace dml
      * @param src_view               @ref data_view to the source memory region
      * @param crc_seed               Initial CRC value
      * @param executor               Instance of @ref execution_interface
-     * @param numa_id                Custom numa id for submission
+     * @param numa_id                Custom numa id for submission, @ref numa_id_current or @ref numa_id_data
      *
      * Usage (software execution path):
      * @code
@@ -655,7 +655,7 @@ namespace dml
      * @param dst_view               @ref data_view to the destination memory region
      * @param crc_seed               Initial CRC value
      * @param executor               Instance of @ref execution_interface
-     * @param numa_id                Custom numa id for submission
+     * @param numa_id                Custom numa id for submission, @ref numa_id_current or @ref numa_id_data
      *
      * Usage (software execution path):
      * @code
@@ -715,7 +715,7 @@ namespace dml
      * @param operation              Instance of @ref cache_flush_operation
      * @param dst_view               @ref data_view to the destination memory region
      * @param executor               Instance of @ref execution_interface
-     * @param numa_id                Custom numa id for submission
+     * @param numa_id                Custom numa id for submission, @ref numa_id_current or @ref numa_id_data
      *
      * Usage (software execution path):
      * @code
@@ -18,6 +18,7 @@
  */
 
 #include <cstdint>
+#include <limits>
 
 namespace dml
 {
@@ -38,6 +39,17 @@ namespace dml
      */
     using byte_t = std::uint8_t;
 
+    /**
+     * @brief Value of numa_id parameters that submits to a device on the NUMA node of the submitting thread
+     */
+    constexpr std::uint32_t numa_id_current = std::numeric_limits<std::uint32_t>::max();
+
+    /**
+     * @brief Value of numa_id parameters that submits to a device on the NUMA node of the destination memory,
+     *        or of the source memory for operations that only read it
+     */
+    constexpr std::uint32_t numa_id_data = std::numeric_limits<std::uint32_t>::max() - 1u;
+
     /**
      * @brief Specifies whether result is expected to be "equal" or "not equal".
      */
@@ -48,6 +60,27 @@ namespace dml
         overflow  = 2u  /**< @todo */
     };
 
+    /**
+     * @brief Specifies how a thread waits for an operation to complete
+     */
+    enum class wait_mode : uint8_t
+    {
+        busy_poll = 0u, /**< Polls the completion record in a loop */
+        umwait    = 1u, /**< Polls the completion record with short umonitor/umwait sleeps */
+        adaptive  = 2u  /**< Spins briefly, sleeps with umwait until the time the operation is expected to take, then
+                             yields the core. The expected time is learned from the observed throughput */
+    };
+
+    /**
+     * @brief Describes one of independent memory regions to calculate CRC of
+     */
+    struct crc_buffer
+    {
+        const byte_t *data; /**< Pointer to the memory region */
+        size_t        size; /**< Size of the memory region in bytes */
+        std::uint32_t seed; /**< Initial CRC value */
+    };
+
     /**
      * @}
      */
@@ -0,0 +1,100 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @date 10/18/2023
+ * @brief Contains @ref work_stealing_executor definition
+ */
+
+#ifndef DML_WORK_STEALING_EXECUTOR_HPP
+#define DML_WORK_STEALING_EXECUTOR_HPP
+
+#include <dml/hl/detail/work_stealing_pool.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace dml
+{
+    /**
+     * @ingroup dmlhl_aux
+     * @brief Executor that runs tasks on a reusable pool of work-stealing threads
+     *
+     * Each worker owns a bounded queue. Tasks submitted from outside the pool are distributed
+     * between the queues round-robin, tasks submitted from a worker go to its own queue.
+     * An idle worker steals from the other queues. If all queues are full, the task runs in
+     * the calling thread.
+     *
+     * Copies of an executor share the same pool. The pool is stopped when the last copy is destroyed,
+     * tasks that are already queued are completed first. The last copy must not be destroyed
+     * by a task running in the same pool.
+     *
+     * Usage:
+     * @code
+     * auto executor = dml::work_stealing_executor(4u, 256u, {0u, 1u, 2u, 3u});
+     *
+     * auto my_exec_iface = dml::execution_interface(executor, std::allocator<dml::byte_t>());
+     *
+     * auto handler = dml::submit<dml::software>(dml::mem_move, dml::make_view(src), dml::make_view(dst), my_exec_iface);
+     * @endcode
+     */
+    class work_stealing_executor
+    {
+    public:
+        /**
+         * @brief Starts a pool of worker threads
+         *
+         * @param thread_count   Number of worker threads
+         * @param queue_capacity Maximal number of queued tasks per worker
+         * @param cpus           CPUs to pin workers to, worker i is pinned to cpus[i % cpus.size()].
+         *                       Workers are not pinned if empty
+         */
+        explicit work_stealing_executor(std::uint32_t              thread_count   = default_thread_count(),
+                                        std::uint32_t              queue_capacity = 256u,
+                                        std::vector<std::uint32_t> cpus           = {}):
+            pool_(std::make_shared<detail::work_stealing_pool>(thread_count, queue_capacity, std::move(cpus)))
+        {
+        }
+
+        /**
+         * @brief Queues a task for execution
+         *
+         * @tparam task_t Type of callable task
+         * @param task    Instance of a callable task
+         */
+        template <typename task_t>
+        void operator()(task_t &&task) const
+        {
+            pool_->push(detail::executor_task(std::forward<task_t>(task)));
+        }
+
+        /**
+         * @brief Returns number of worker threads
+         */
+        [[nodiscard]] std::uint32_t thread_count() const noexcept
+        {
+            return pool_->thread_count();
+        }
+
+        /**
+         * @brief Returns number of hardware threads, or 1 if it cannot be detected
+         */
+        [[nodiscard]] static std::uint32_t default_thread_count() noexcept
+        {
+            const auto count = std::thread::hardware_concurrency();
+
+            return count != 0u ? count : 1u;
+        }
+
+    private:
+        std::shared_ptr<detail::work_stealing_pool> pool_; /**< Pool shared between copies */
+    };
+}  // namespace dml
+
+#endif  //DML_WORK_STEALING_EXECUTOR_HPP
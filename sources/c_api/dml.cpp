@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
+#include <dml/detail/ml/crc.hpp>
+#include <dml/detail/ml/wait.hpp>
 #include <dml/dml.h>
 
 #include <memory>
@@ -54,7 +56,7 @@ extern "C" dml_status_t dml_execute_job(dml_job_t *const dml_job_ptr, dml_wait_m
 {
     CHECK_NULL(dml_job_ptr);
 
-    return dml::execute(dml::job_view(dml_job_ptr), bool(wait_mode));
+    return dml::execute(dml::job_view(dml_job_ptr), dml::to_wait_mode(wait_mode));
 }
 
 extern "C" dml_status_t dml_submit_job(dml_job_t *const dml_job_ptr)
@@ -75,7 +77,198 @@ extern "C" dml_status_t dml_wait_job(dml_job_t *const dml_job_ptr, dml_wait_mode
 {
     CHECK_NULL(dml_job_ptr);
 
-    return dml::wait(dml::job_view(dml_job_ptr), bool(wait_mode));
+    return dml::wait(dml::job_view(dml_job_ptr), dml::to_wait_mode(wait_mode));
+}
+
+extern "C" dml_status_t dml_check_many(dml_job_t **const dml_jobs_ptr, uint32_t jobs_count, uint64_t *const completion_mask_ptr)
+{
+    CHECK_NULL(dml_jobs_ptr);
+    CHECK_NULL(completion_mask_ptr);
+
+    for (uint32_t i = 0u; i < jobs_count; ++i)
+    {
+        CHECK_NULL(dml_jobs_ptr[i]);
+    }
+
+    for (uint32_t word = 0u; word < (jobs_count + 63u) / 64u; ++word)
+    {
+        completion_mask_ptr[word] = 0u;
+    }
+
+    for (uint32_t i = 0u; i < jobs_count; ++i)
+    {
+        auto job = dml::job_view(dml_jobs_ptr[i]);
+
+        if (dml::finished(job))
+        {
+            static_cast<void>(dml::write_result(job));
+            completion_mask_ptr[i / 64u] |= uint64_t(1u) << (i % 64u);
+        }
+    }
+
+    return DML_STATUS_OK;
+}
+
+extern "C" dml_status_t dml_wait_any(dml_job_t **const dml_jobs_ptr,
+                                     uint32_t          jobs_count,
+                                     dml_wait_mode_t   wait_mode,
+                                     uint32_t *const   job_index_ptr)
+{
+    CHECK_NULL(dml_jobs_ptr);
+    CHECK_NULL(job_index_ptr);
+
+    for (uint32_t i = 0u; i < jobs_count; ++i)
+    {
+        CHECK_NULL(dml_jobs_ptr[i]);
+    }
+
+    if (jobs_count == 0u)
+    {
+        return DML_STATUS_LIMITS_ERROR;
+    }
+
+    const auto index = dml::detail::ml::wait_any(
+        jobs_count,
+        dml::to_wait_mode(wait_mode),
+        [dml_jobs_ptr](size_t i) { return dml::finished(dml::job_view(dml_jobs_ptr[i])); },
+        [dml_jobs_ptr](size_t i) -> auto & { return dml::completion_record(dml::job_view(dml_jobs_ptr[i])); });
+
+    *job_index_ptr = static_cast<uint32_t>(index);
+
+    return dml::write_result(dml::job_view(dml_jobs_ptr[index]));
+}
+
+extern "C" dml_status_t dml_wait_all(dml_job_t **const dml_jobs_ptr, uint32_t jobs_count, dml_wait_mode_t wait_mode)
+{
+    CHECK_NULL(dml_jobs_ptr);
+
+    for (uint32_t i = 0u; i < jobs_count; ++i)
+    {
+        CHECK_NULL(dml_jobs_ptr[i]);
+    }
+
+    dml::detail::ml::wait_all(
+        jobs_count,
+        dml::to_wait_mode(wait_mode),
+        [dml_jobs_ptr](size_t i) { return dml::finished(dml::job_view(dml_jobs_ptr[i])); },
+        [dml_jobs_ptr](size_t i) -> auto & { return dml::completion_record(dml::job_view(dml_jobs_ptr[i])); });
+
+    auto status = DML_STATUS_OK;
+
+    // Results of all jobs are written, the first failure is reported
+    for (uint32_t i = 0u; i < jobs_count; ++i)
+    {
+        const auto job_status = dml::write_result(dml::job_view(dml_jobs_ptr[i]));
+
+        status = (status == DML_STATUS_OK) ? job_status : status;
+    }
+
+    return status;
+}
+
+extern "C" dml_status_t dml_init_completion_queue(dml_completion_queue_t *const  queue_ptr,
+                                                  dml_completion_entry_t *const entries_ptr,
+                                                  uint32_t                      capacity)
+{
+    CHECK_NULL(queue_ptr);
+    CHECK_NULL(entries_ptr);
+
+    if (capacity == 0u)
+    {
+        return DML_STATUS_LIMITS_ERROR;
+    }
+
+    queue_ptr->entries_ptr = entries_ptr;
+    queue_ptr->capacity    = capacity;
+    queue_ptr->head        = 0u;
+    queue_ptr->count       = 0u;
+
+    return DML_STATUS_OK;
+}
+
+extern "C" dml_status_t dml_submit_job_to_queue(dml_completion_queue_t *const queue_ptr,
+                                                dml_job_t *const              dml_job_ptr,
+                                                uint64_t                      user_data)
+{
+    CHECK_NULL(queue_ptr);
+    CHECK_NULL(queue_ptr->entries_ptr);
+    CHECK_NULL(dml_job_ptr);
+
+    if (queue_ptr->count == queue_ptr->capacity)
+    {
+        return DML_STATUS_LIMITS_ERROR;
+    }
+
+    const auto status = dml::submit(dml::job_view(dml_job_ptr));
+
+    if (status != DML_STATUS_OK)
+    {
+        return status;
+    }
+
+    auto &entry = queue_ptr->entries_ptr[(queue_ptr->head + queue_ptr->count) % queue_ptr->capacity];
+
+    entry.job_ptr   = dml_job_ptr;
+    entry.user_data = user_data;
+    entry.status    = DML_STATUS_BEING_PROCESSED;
+
+    ++queue_ptr->count;
+
+    return DML_STATUS_OK;
+}
+
+extern "C" dml_status_t dml_reap_completions(dml_completion_queue_t *const queue_ptr,
+                                             dml_completion_entry_t *const completions_ptr,
+                                             uint32_t                      min_count,
+                                             uint32_t                      max_count,
+                                             dml_wait_mode_t               wait_mode,
+                                             uint32_t *const               reaped_count_ptr)
+{
+    CHECK_NULL(queue_ptr);
+    CHECK_NULL(queue_ptr->entries_ptr);
+    CHECK_NULL(completions_ptr);
+    CHECK_NULL(reaped_count_ptr);
+
+    if (min_count > max_count || min_count > queue_ptr->count)
+    {
+        return DML_STATUS_LIMITS_ERROR;
+    }
+
+    auto reaped = 0u;
+
+    for (std::uint32_t scan = 0u;; ++scan)
+    {
+        // Jobs are taken from the head in submission order, so a scan only looks at the jobs it reaps and the one after
+        while (reaped < max_count && queue_ptr->count != 0u)
+        {
+            const auto &entry = queue_ptr->entries_ptr[queue_ptr->head];
+
+            if (!dml::finished(dml::job_view(entry.job_ptr)))
+            {
+                break;
+            }
+
+            completions_ptr[reaped]        = entry;
+            completions_ptr[reaped].status = dml::write_result(dml::job_view(entry.job_ptr));
+
+            queue_ptr->head = (queue_ptr->head + 1u) % queue_ptr->capacity;
+            --queue_ptr->count;
+            ++reaped;
+        }
+
+        if (reaped >= min_count)
+        {
+            break;
+        }
+
+        dml::detail::ml::rest_between_scans(dml::completion_record(dml::job_view(queue_ptr->entries_ptr[queue_ptr->head].job_ptr)),
+                                            dml::to_wait_mode(wait_mode),
+                                            scan);
+    }
+
+    *reaped_count_ptr = reaped;
+
+    return DML_STATUS_OK;
 }
 
 extern "C" dml_status_t dml_finalize_job(dml_job_t *const dml_job_ptr)
@@ -87,3 +280,21 @@ extern "C" dml_status_t dml_finalize_job(dml_job_t *const dml_job_ptr)
 
     return DML_STATUS_OK;
 }
+
+extern "C" dml_status_t dml_crc_combine(uint32_t              crc_a,
+                                        uint32_t              crc_b,
+                                        uint64_t              length_b,
+                                        uint32_t              polynomial,
+                                        dml_operation_flags_t flags,
+                                        uint32_t *const       crc_ptr)
+{
+    CHECK_NULL(crc_ptr);
+
+    *crc_ptr = dml::detail::ml::crc_combine(crc_a,
+                                            crc_b,
+                                            length_b,
+                                            polynomial,
+                                            dml::detail::ml::crc_specific_options(static_cast<uint8_t>((flags >> 16) & 0xFF)));
+
+    return DML_STATUS_OK;
+}
@@ -328,6 +328,40 @@ extern "C" dml_status_t dml_batch_set_crc_by_index(dml_job_t            *dml_job
     return DML_STATUS_OK;
 }
 
+extern "C" dml_status_t dml_batch_set_crc_buffers(dml_job_t              *dml_job_ptr,
+                                                  uint32_t                first_task_index,
+                                                  const dml_crc_buffer_t *buffers_ptr,
+                                                  uint32_t                buffers_count,
+                                                  dml_operation_flags_t   flags)
+{
+    CHECK_NULL(dml_job_ptr);
+    CHECK_NULL(buffers_ptr);
+
+    const auto task_count = dml_job_ptr->destination_length / dml::get_task_size();
+    if (first_task_index >= task_count || buffers_count > task_count - first_task_index)
+    {
+        return DML_STATUS_BATCH_TASK_INDEX_OVERFLOW;
+    }
+
+    for (uint32_t i = 0u; i < buffers_count; ++i)
+    {
+        auto crc_seed = buffers_ptr[i].crc_seed;
+
+        auto status = dml_batch_set_crc_by_index(dml_job_ptr,
+                                                 first_task_index + i,
+                                                 buffers_ptr[i].source_ptr,
+                                                 buffers_ptr[i].byte_length,
+                                                 &crc_seed,
+                                                 flags);
+        if (status != DML_STATUS_OK)
+        {
+            return status;
+        }
+    }
+
+    return DML_STATUS_OK;
+}
+
 extern "C" dml_status_t dml_batch_set_copy_crc_by_index(dml_job_t            *dml_job_ptr,
                                                         uint32_t              task_index,
                                                         uint8_t              *source_ptr,
@@ -768,3 +802,19 @@ extern "C" dml_status_t dml_batch_get_status(const dml_job_t *dml_job_ptr, uint3
 
     return DML_STATUS_OK;
 }
+
+extern "C" dml_status_t dml_batch_get_crc(const dml_job_t *dml_job_ptr, uint32_t task_index, uint32_t *crc_ptr)
+{
+    CHECK_NULL(dml_job_ptr);
+    CHECK_NULL(crc_ptr);
+
+    const auto task_count = dml_job_ptr->destination_length / dml::get_task_size();
+    if (task_index >= task_count)
+    {
+        return DML_STATUS_BATCH_TASK_INDEX_OVERFLOW;
+    }
+
+    *crc_ptr = dml::detail::ml::get_crc_value(dml::batch(dml_job_ptr->destination_first_ptr, task_count).get_record(task_index));
+
+    return DML_STATUS_OK;
+}
@@ -7,6 +7,7 @@
 #ifndef DML_IMPL_HPP
 #define DML_IMPL_HPP
 
+#include <dml/detail/ml/direct.hpp>
 #include <dml/detail/ml/execution_path.hpp>
 #include <dml/detail/ml/view.hpp>
 
@@ -17,20 +18,36 @@
 
 namespace dml
 {
-    [[nodiscard]] static inline dml_status_t wait(job_view job, bool umwait) noexcept
+    /**
+     * @brief Converts the wait mode of the C API, unknown nonzero values select umwait as when the mode was a flag
+     */
+    [[nodiscard]] static inline detail::wait_mode to_wait_mode(dml_wait_mode_t wait_mode) noexcept
+    {
+        switch (wait_mode)
+        {
+            case DML_WAIT_MODE_BUSY_POLL:
+                return detail::wait_mode::busy_poll;
+            case DML_WAIT_MODE_ADAPTIVE:
+                return detail::wait_mode::adaptive;
+            default:
+                return detail::wait_mode::umwait;
+        }
+    }
+
+    [[nodiscard]] static inline dml_status_t wait(job_view job, detail::wait_mode mode) noexcept
     {
         auto task_view = detail::ml::make_view(job.state().task);
 
         switch (job.state().path)
         {
             case DML_PATH_SW:
-                detail::ml::wait<detail::ml::execution_path::software>(task_view, umwait);
+                detail::ml::wait<detail::ml::execution_path::software>(task_view, mode);
                 break;
             case DML_PATH_HW:
-                detail::ml::wait<detail::ml::execution_path::hardware>(task_view, umwait);
+                detail::ml::wait<detail::ml::execution_path::hardware>(task_view, mode);
                 break;
             case DML_PATH_AUTO:
-                detail::ml::wait<detail::ml::execution_path::automatic>(task_view, umwait);
+                detail::ml::wait<detail::ml::execution_path::automatic>(task_view, mode);
                 break;
         }
 
@@ -38,26 +55,31 @@ namespace dml
         return write_result(job);
     }
 
-    [[nodiscard]] static inline dml_status_t check(job_view job) noexcept
+    [[nodiscard]] static inline bool finished(job_view job) noexcept
     {
-        bool finished = false;
-
         auto task_view = detail::ml::make_view(job.state().task);
 
         switch (job.state().path)
         {
             case DML_PATH_SW:
-                finished = detail::ml::finished<detail::ml::execution_path::software>(task_view);
-                break;
+                return detail::ml::finished<detail::ml::execution_path::software>(task_view);
             case DML_PATH_HW:
-                finished = detail::ml::finished<detail::ml::execution_path::hardware>(task_view);
-                break;
+                return detail::ml::finished<detail::ml::execution_path::hardware>(task_view);
             case DML_PATH_AUTO:
-                finished = detail::ml::finished<detail::ml::execution_path::automatic>(task_view);
-                break;
+                return detail::ml::finished<detail::ml::execution_path::automatic>(task_view);
         }
 
-        if (finished)
+        return false;
+    }
+
+    [[nodiscard]] static inline auto &completion_record(job_view job) noexcept
+    {
+        return detail::ml::make_view(job.state().task).get_completion_record();
+    }
+
+    [[nodiscard]] static inline dml_status_t check(job_view job) noexcept
+    {
+        if (finished(job))
         {
             // Extract result
             return write_result(job);
@@ -68,12 +90,65 @@ namespace dml
         }
     }
 
+    /**
+     * @brief Executes small software path operations with direct kernel calls
+     *
+     * @return true if the job is completed, false if it has to be submitted
+     */
+    [[nodiscard]] static inline bool submit_direct(job_view job) noexcept
+    {
+        namespace direct = detail::ml::direct;
+
+        switch (job.operation())
+        {
+            case DML_OP_MEM_MOVE:
+                if (direct::is_applicable(job.source_length(), job.source_first(), job.destination_first()))
+                {
+                    direct::mem_move(job.source_first(), job.destination_first(), job.source_length());
+                    direct::complete(make_view(job.state().task));
+                    return true;
+                }
+                break;
+            case DML_OP_FILL:
+                if (direct::is_applicable(job.destination_length(), job.destination_first()))
+                {
+                    direct::fill(job.pattern(), job.destination_first(), job.destination_length());
+                    direct::complete(make_view(job.state().task));
+                    return true;
+                }
+                break;
+            case DML_OP_CRC:
+                if (direct::is_applicable(job.source_length(), job.source_first()))
+                {
+                    const auto read_seed = intersects(job.specific_flags(), detail::crc_specific_flag::read_crc_seed);
+                    const auto crc_value = direct::crc(job.source_first(),
+                                                       job.source_length(),
+                                                       read_seed ? *job.crc_ptr() : 0u,
+                                                       detail::ml::crc_specific_options(job.specific_flags()));
+
+                    direct::complete(make_view(job.state().task), crc_value);
+                    return true;
+                }
+                break;
+            default:
+                break;
+        }
+
+        return false;
+    }
+
     [[nodiscard]] static inline dml_status_t submit(job_view job) noexcept
     {
         if (auto status = range_check(job); status != DML_STATUS_OK)
         {
             return status;
         }
+
+        if (job.state().path == DML_PATH_SW && submit_direct(job))
+        {
+            return DML_STATUS_OK;
+        }
+
         if(job.operation() == DML_OP_MEM_MOVE && job.flags() & DML_FLAG_COPY_ONLY){
             job.set_flags( job.flags() & ~DML_FLAG_COPY_ONLY);
         }
@@ -112,7 +187,7 @@ namespace dml
         return DML_STATUS_OK;
     }
 
-    [[nodiscard]] static inline dml_status_t execute(job_view job, bool umwait) noexcept
+    [[nodiscard]] static inline dml_status_t execute(job_view job, detail::wait_mode mode) noexcept
     {
         if (auto status = submit(job); status != DML_STATUS_OK)
         {
@@ -120,7 +195,7 @@ namespace dml
         }
 
         // Busy polling
-        return wait(job, umwait);
+        return wait(job, mode);
     }
 
 }  // namespace dml
@@ -9,19 +9,47 @@
 
 #include <core/types.hpp>
 #include <dml/detail/common/status.hpp>
+#include <limits>
+
+namespace dml::core::dispatch
+{
+    struct wait_estimate;
+}  // namespace dml::core::dispatch
 
 namespace dml::core
 {
     class software_device
     {
     public:
-        [[nodiscard]] dml::detail::submission_status submit(const descriptor& dsc) noexcept;
+        [[nodiscard]] dml::detail::submission_status submit(const descriptor& dsc,
+                                                            std::uint32_t     numa_id = std::numeric_limits<std::uint32_t>::max()) noexcept;
+
+        [[nodiscard]] dml::detail::submission_status execute(const descriptor& dsc) noexcept;
+
+        /**
+         * @brief Returns the expected duration of software transfers used by adaptive waits
+         */
+        [[nodiscard]] dispatch::wait_estimate& wait_estimate() noexcept;
     };
 
     class hardware_device
     {
     public:
         [[nodiscard]] dml::detail::submission_status submit(const descriptor& descriptor, std::uint32_t numa_id) noexcept;
+
+        /**
+         * @brief Returns device resources held by a descriptor, called once its completion record is seen written
+         *
+         * Dedicated queues take new descriptors only as earlier ones are released.
+         */
+        void release(const descriptor& dsc) noexcept;
+
+        /**
+         * @brief Returns the expected duration of hardware transfers used by adaptive waits for the descriptor
+         *
+         * The device a descriptor went to is not recorded, so devices of the node it is placed on share an estimate
+         */
+        [[nodiscard]] dispatch::wait_estimate& wait_estimate(const descriptor& dsc) noexcept;
     };
 }  // namespace dml::core
 
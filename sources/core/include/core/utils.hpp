@@ -9,6 +9,8 @@
 
 #include <core/view.hpp>
 
+#include <cstdint>
+
 namespace dml::core
 {
     // TODO: Should not be passed by ref
@@ -24,6 +26,20 @@ namespace dml::core
         auto view = any_descriptor(dsc);
         return get_completion_record(view);
     }
+
+    /**
+     * @brief Reverses the bit order of a 32-bit value, CRC values are kept reflected in completion records
+     */
+    [[nodiscard]] constexpr std::uint32_t reverse_bits(std::uint32_t value) noexcept
+    {
+        value = (value & 0x55555555u) << 1u | (value & 0xAAAAAAAAu) >> 1u;
+        value = (value & 0x33333333u) << 2u | (value & 0xCCCCCCCCu) >> 2u;
+        value = (value & 0x0F0F0F0Fu) << 4u | (value & 0xF0F0F0F0u) >> 4u;
+        value = (value & 0x00FF00FFu) << 8u | (value & 0xFF00FF00u) >> 8u;
+        value = (value & 0x0000FFFFu) << 16u | (value & 0xFFFF0000u) >> 16u;
+
+        return value;
+    }
 }  // namespace dml::core
 
 #endif  //DML_CORE_UTILS_HPP
@@ -8,97 +8,205 @@
 #include <core/descriptor_views.hpp>
 #include <core/operations.hpp>
 #include <core/utils.hpp>
+#include <dml/detail/common/flags.hpp>
 #include <dml/detail/common/status.hpp>
 #include <dml/detail/common/utils/enum.hpp>
+#include <vector>
 
 #include "immintrin.h"
 #include "kernels.hpp"
+#include "sw_engine/parallel_pool.hpp"
 
 namespace dml::core::kernels
 {
+    /**
+     * @brief Executes a single batch entry and returns true if it completed successfully
+     */
+    static bool execute_entry(const descriptor &current_dsc) noexcept
+    {
+        auto &current_record = *reinterpret_cast<completion_record *>(any_descriptor(current_dsc).completion_record_address());
+
+        auto op = operation(any_descriptor(current_dsc).operation());
+
+        switch (op)
+        {
+            case operation::nop:
+                kernels::nop(make_view<operation::nop>(current_dsc));
+                break;
+            case operation::mem_move:
+                kernels::mem_move(make_view<operation::mem_move>(current_dsc));
+                break;
+            case operation::fill:
+                kernels::fill(make_view<operation::fill>(current_dsc));
+                break;
+            case operation::compare:
+                kernels::compare(make_view<operation::compare>(current_dsc));
+                break;
+            case operation::compare_pattern:
+                kernels::compare_pattern(make_view<operation::compare_pattern>(current_dsc));
+                break;
+            case operation::create_delta:
+                kernels::create_delta(make_view<operation::create_delta>(current_dsc));
+                break;
+            case operation::apply_delta:
+                kernels::apply_delta(make_view<operation::apply_delta>(current_dsc));
+                break;
+            case operation::dualcast:
+                kernels::dualcast(make_view<operation::dualcast>(current_dsc));
+                break;
+            case operation::crc:
+                kernels::crc(make_view<operation::crc>(current_dsc));
+                break;
+            case operation::copy_crc:
+                kernels::copy_crc(make_view<operation::copy_crc>(current_dsc));
+                break;
+            case operation::dif_check:
+                kernels::dif_check(make_view<operation::dif_check>(current_dsc));
+                break;
+            case operation::dif_insert:
+                kernels::dif_insert(make_view<operation::dif_insert>(current_dsc));
+                break;
+            case operation::dif_strip:
+                kernels::dif_strip(make_view<operation::dif_strip>(current_dsc));
+                break;
+            case operation::dif_update:
+                kernels::dif_update(make_view<operation::dif_update>(current_dsc));
+                break;
+            case operation::cache_flush:
+                kernels::cache_flush(make_view<operation::cache_flush>(current_dsc));
+                break;
+            default:
+                return false;
+        }
+
+        return any_completion_record(current_record).status() == to_underlying(dml::detail::execution_status::success);
+    }
+
+    /**
+     * @brief Executes entries [first, last) in parallel and returns index of the first failed one or last
+     *
+     * Records of entries following the failed one are restored, so they look the same as if the
+     * segment was executed sequentially and stopped at the failure.
+     */
+    static size_t execute_segment(const descriptor *operations, size_t first, size_t last) noexcept
+    {
+        const auto count = last - first;
+
+        auto records   = std::vector<completion_record *>(count);
+        auto snapshots = std::vector<completion_record>(count);
+        auto succeeded = std::vector<std::uint8_t>(count);
+
+        for (size_t i = 0u; i < count; ++i)
+        {
+            records[i]   = reinterpret_cast<completion_record *>(any_descriptor(operations[first + i]).completion_record_address());
+            snapshots[i] = *records[i];
+        }
+
+        struct context_t
+        {
+            const descriptor          *operations;
+            std::vector<std::uint8_t> &succeeded;
+        } context{ operations + first, succeeded };
+
+        engine::parallel_pool::get_instance().run(static_cast<std::uint32_t>(count),
+                                                  [](void *raw_context, std::uint32_t entry)
+                                                  {
+                                                      auto &ctx           = *static_cast<context_t *>(raw_context);
+                                                      ctx.succeeded[entry] = execute_entry(ctx.operations[entry]) ? 1u : 0u;
+                                                  },
+                                                  &context);
+
+        for (size_t i = 0u; i < count; ++i)
+        {
+            if (succeeded[i] == 0u)
+            {
+                for (size_t j = i + 1u; j < count; ++j)
+                {
+                    *records[j] = snapshots[j];
+                }
+
+                return first + i;
+            }
+        }
+
+        return last;
+    }
+
+    /**
+     * @brief Returns true for CRC entries small enough to be hashed along with their neighbours
+     */
+    static bool is_multi_buffer_crc(const descriptor &dsc) noexcept
+    {
+        // Larger buffers are split between threads by the regular kernel
+        constexpr uint32_t max_size = 64u * 1024u;
+
+        auto view = any_descriptor(dsc);
+
+        return operation(view.operation()) == operation::crc && make_view<operation::crc>(dsc).transfer_size() <= max_size;
+    }
+
     void batch(const_view<descriptor, operation::batch> dsc) noexcept
     {
         auto record = make_view<operation::batch>(get_completion_record(dsc));
 
         const auto operations        = reinterpret_cast<descriptor *>(dsc.descriptor_list_address());
         const auto descriptors_count = dsc.descriptors_count();
+        const auto parallel          = engine::parallel_pool::get_instance().thread_count() > 1u;
 
-        auto status = dml::detail::execution_status::processing;
-        auto index  = size_t(0);
+        auto index = size_t(0);
 
-        while (index < descriptors_count && status == dml::detail::execution_status::processing)
+        while (index < descriptors_count)
         {
-            const auto &current_dsc    = operations[index];
-            auto       &current_record = *reinterpret_cast<completion_record *>(any_descriptor(current_dsc).completion_record_address());
+            // A run of CRC entries only reads memory and everything before it is complete, so fences do not split it
+            auto run_end = index;
 
-            auto op = operation(any_descriptor(current_dsc).operation());
+            while (run_end < descriptors_count && is_multi_buffer_crc(operations[run_end]))
+            {
+                ++run_end;
+            }
 
-            switch (op)
+            if (run_end - index > 1u)
             {
-                case operation::nop:
-                    kernels::nop(make_view<operation::nop>(current_dsc));
-                    break;
-                case operation::mem_move:
-                    kernels::mem_move(make_view<operation::mem_move>(current_dsc));
-                    break;
-                case operation::fill:
-                    kernels::fill(make_view<operation::fill>(current_dsc));
-                    break;
-                case operation::compare:
-                    kernels::compare(make_view<operation::compare>(current_dsc));
-                    break;
-                case operation::compare_pattern:
-                    kernels::compare_pattern(make_view<operation::compare_pattern>(current_dsc));
-                    break;
-                case operation::create_delta:
-                    kernels::create_delta(make_view<operation::create_delta>(current_dsc));
-                    break;
-                case operation::apply_delta:
-                    kernels::apply_delta(make_view<operation::apply_delta>(current_dsc));
-                    break;
-                case operation::dualcast:
-                    kernels::dualcast(make_view<operation::dualcast>(current_dsc));
-                    break;
-                case operation::crc:
-                    kernels::crc(make_view<operation::crc>(current_dsc));
-                    break;
-                case operation::copy_crc:
-                    kernels::copy_crc(make_view<operation::copy_crc>(current_dsc));
-                    break;
-                case operation::dif_check:
-                    kernels::dif_check(make_view<operation::dif_check>(current_dsc));
-                    break;
-                case operation::dif_insert:
-                    kernels::dif_insert(make_view<operation::dif_insert>(current_dsc));
-                    break;
-                case operation::dif_strip:
-                    kernels::dif_strip(make_view<operation::dif_strip>(current_dsc));
-                    break;
-                case operation::dif_update:
-                    kernels::dif_update(make_view<operation::dif_update>(current_dsc));
-                    break;
-                case operation::cache_flush:
-                    kernels::cache_flush(make_view<operation::cache_flush>(current_dsc));
-                    break;
-                default:
-                    status = dml::detail::execution_status::batch_error;
+                kernels::crc_multi(operations + index, run_end - index);
+
+                index = run_end;
+                continue;
             }
 
-            if (any_completion_record(current_record).status() != to_underlying(dml::detail::execution_status::success))
+            // A segment lasts until the next fenced entry, which has to wait for everything before it
+            auto segment_end = index + 1u;
+
+            while (parallel && segment_end < descriptors_count &&
+                   !intersects(any_descriptor(operations[segment_end]).flags(), dml::detail::flag::fence))
             {
-                status = dml::detail::execution_status::batch_error;
+                ++segment_end;
             }
-            else
+
+            if (segment_end - index == 1u)
             {
+                if (!execute_entry(operations[index]))
+                {
+                    break;
+                }
+
                 ++index;
             }
-        }
+            else
+            {
+                const auto failed = execute_segment(operations, index, segment_end);
 
-        if (index == descriptors_count)
-        {
-            status = dml::detail::execution_status::success;
+                index = failed;
+
+                if (failed != segment_end)
+                {
+                    break;
+                }
+            }
         }
 
+        const auto status =
+            (index == descriptors_count) ? dml::detail::execution_status::success : dml::detail::execution_status::batch_error;
+
         record.descriptors_completed() = static_cast<transfer_size_t>(index);
 
         _mm_mfence();
@@ -14,6 +14,9 @@
 
 #include "immintrin.h"
 #include "kernels.hpp"
+#include "sw_engine/parallel_pool.hpp"
+
+#include <vector>
 
 namespace dml::core::kernels
 {
@@ -27,7 +30,36 @@ namespace dml::core::kernels
         const auto expected_result = dsc.expected_result();
         const auto check_result    = intersects(dsc.flags(), dml::detail::compare_flag::check_result);
 
-        std::tie(record.bytes_completed(), record.result()) = dispatch::compare(src1, src2, transfer_size);
+        const auto chunks = engine::parallel_pool::get_instance().split(transfer_size, engine::cache_line_size);
+
+        if (chunks.chunk_count == 1u)
+        {
+            std::tie(record.bytes_completed(), record.result()) = dispatch::compare(src1, src2, transfer_size);
+        }
+        else
+        {
+            auto partial = std::vector<std::tuple<uint32_t, uint8_t>>(chunks.chunk_count);
+
+            engine::parallel_for(chunks,
+                                 [&](std::uint32_t chunk, std::uint32_t offset, std::uint32_t size)
+                                 { partial[chunk] = dispatch::compare(src1 + offset, src2 + offset, size); });
+
+            // The first mismatch belongs to the first chunk that has one
+            record.bytes_completed() = 0u;
+            record.result()          = 0u;
+
+            for (std::uint32_t chunk = 0u; chunk < chunks.chunk_count; ++chunk)
+            {
+                const auto [mismatch, result] = partial[chunk];
+
+                if (result != 0u)
+                {
+                    record.bytes_completed() = chunk * chunks.chunk_size + mismatch;
+                    record.result()          = result;
+                    break;
+                }
+            }
+        }
 
         _mm_mfence();
         record.status() =
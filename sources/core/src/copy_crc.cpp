@@ -28,36 +28,23 @@ namespace dml::core::kernels
         const auto bypass_data_reflection =
             intersects(dsc.operation_specific_flags(), dml::detail::crc_specific_flag::bypass_data_reflection);
 
-        dispatch::mem_move(src, dst, transfer_size);
-
-        auto reverse = [](uint32_t value)
-        {
-            value = (value & 0x55555555u) << 1u | (value & 0xAAAAAAAAu) >> 1u;
-            value = (value & 0x33333333u) << 2u | (value & 0xCCCCCCCCu) >> 2u;
-            value = (value & 0x0F0F0F0Fu) << 4u | (value & 0xF0F0F0F0u) >> 4u;
-            value = (value & 0x00FF00FFu) << 8u | (value & 0xFF00FF00u) >> 8u;
-            value = (value & 0x0000FFFFu) << 16u | (value & 0xFFFF0000u) >> 16u;
-
-            return value;
-        };
-
         auto crc_value = crc_seed;
 
         // Bypass inversion and use reverse bit order for CRC completion_record
         if (!bypass_reflection)
         {
             crc_value = ~(crc_value);
-            crc_value = reverse(crc_value);
+            crc_value = reverse_bits(crc_value);
         }
 
-        // Bypass Data Reflection in case if DML_FLAG_DATA_REFLECTION set
-        crc_value =
-            !bypass_data_reflection ? dispatch::crc_reflected(src, transfer_size, crc_value) : dispatch::crc(src, transfer_size, crc_value);
+        // Bypass Data Reflection in case if DML_FLAG_DATA_REFLECTION set, the copy is done by the same pass
+        crc_value = !bypass_data_reflection ? dispatch::copy_crc_reflected(src, dst, transfer_size, crc_value)
+                                            : dispatch::copy_crc(src, dst, transfer_size, crc_value);
 
         // Bypass inversion and use reverse bit order for CRC completion_record
         if (!bypass_reflection)
         {
-            crc_value = reverse(crc_value);
+            crc_value = reverse_bits(crc_value);
             crc_value = ~(crc_value);
         }
 
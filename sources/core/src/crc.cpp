@@ -12,9 +12,27 @@
 
 #include "immintrin.h"
 #include "kernels.hpp"
+#include "sw_engine/parallel_pool.hpp"
+
+#include <algorithm>
+#include <vector>
 
 namespace dml::core::kernels
 {
+    namespace
+    {
+        // Bypass inversion and use reverse bit order for CRC completion_record
+        auto to_kernel_crc(uint32_t crc_value, bool bypass_reflection) noexcept
+        {
+            return bypass_reflection ? crc_value : reverse_bits(~crc_value);
+        }
+
+        auto to_record_crc(uint32_t crc_value, bool bypass_reflection) noexcept
+        {
+            return bypass_reflection ? crc_value : ~reverse_bits(crc_value);
+        }
+    }  // namespace
+
     void crc(const_view<descriptor, operation::crc> dsc) noexcept
     {
         auto record = make_view<operation::crc>(get_completion_record(dsc));
@@ -27,40 +45,101 @@ namespace dml::core::kernels
         const auto bypass_data_reflection =
             intersects(dsc.operation_specific_flags(), dml::detail::crc_specific_flag::bypass_data_reflection);
 
-        auto reverse = [](uint32_t value)
-        {
-            value = (value & 0x55555555u) << 1u | (value & 0xAAAAAAAAu) >> 1u;
-            value = (value & 0x33333333u) << 2u | (value & 0xCCCCCCCCu) >> 2u;
-            value = (value & 0x0F0F0F0Fu) << 4u | (value & 0xF0F0F0F0u) >> 4u;
-            value = (value & 0x00FF00FFu) << 8u | (value & 0xFF00FF00u) >> 8u;
-            value = (value & 0x0000FFFFu) << 16u | (value & 0xFFFF0000u) >> 16u;
+        auto crc_value = to_kernel_crc(crc_seed, bypass_reflection);
 
-            return value;
-        };
+        // Bypass Data Reflection in case if DML_FLAG_DATA_REFLECTION set
+        auto update = [bypass_data_reflection](const byte_t *data, std::uint32_t size, std::uint32_t value)
+        { return !bypass_data_reflection ? dispatch::crc_reflected(data, size, value) : dispatch::crc(data, size, value); };
 
-        auto crc_value = crc_seed;
+        const auto chunks = engine::parallel_pool::get_instance().split(transfer_size, engine::cache_line_size);
 
-        // Bypass inversion and use reverse bit order for CRC completion_record
-        if (!bypass_reflection)
+        if (chunks.chunk_count == 1u)
         {
-            crc_value = ~(crc_value);
-            crc_value = reverse(crc_value);
+            crc_value = update(src, transfer_size, crc_value);
         }
+        else
+        {
+            // Chunks after the first one start from zero and are merged using CRC linearity:
+            // crc(s, A + B) = crc(s, A) * x^(8 * |B|) + crc(0, B)
+            auto partial = std::vector<std::uint32_t>(chunks.chunk_count);
 
-        // Bypass Data Reflection in case if DML_FLAG_DATA_REFLECTION set
-        crc_value =
-            !bypass_data_reflection ? dispatch::crc_reflected(src, transfer_size, crc_value) : dispatch::crc(src, transfer_size, crc_value);
+            engine::parallel_for(chunks,
+                                 [&](std::uint32_t chunk, std::uint32_t offset, std::uint32_t size)
+                                 { partial[chunk] = update(src + offset, size, (chunk == 0u) ? crc_value : 0u); });
 
-        // Bypass inversion and use reverse bit order for CRC completion_record
-        if (!bypass_reflection)
-        {
-            crc_value = reverse(crc_value);
-            crc_value = ~(crc_value);
+            crc_value = partial[0];
+
+            for (std::uint32_t chunk = 1u; chunk < chunks.chunk_count; ++chunk)
+            {
+                const auto offset = chunk * chunks.chunk_size;
+                const auto size   = (chunk + 1u == chunks.chunk_count) ? transfer_size - offset : chunks.chunk_size;
+
+                crc_value = dispatch::crc_shift(crc_value, size) ^ partial[chunk];
+            }
         }
 
-        record.crc_value() = crc_value;
+        record.crc_value() = to_record_crc(crc_value, bypass_reflection);
 
         _mm_mfence();
         record.status() = to_underlying(dml::detail::execution_status::success);
     }
+
+    void crc_multi(const descriptor *descriptors, size_t count) noexcept
+    {
+        // Buffers gathered per kernel call, so everything lives on the stack
+        constexpr size_t group_size = 64u;
+
+        for (size_t first = 0u; first < count; first += group_size)
+        {
+            const auto group_count = std::min(group_size, count - first);
+
+            // Buffers with and without data reflection go to different kernels
+            const uint8_t *srcs[2][group_size];
+            uint32_t       sizes[2][group_size];
+            uint32_t       crcs[2][group_size];
+            size_t         entries[2][group_size];
+            uint32_t       kernel_counts[2] = {};
+
+            for (size_t i = 0u; i < group_count; ++i)
+            {
+                auto dsc = make_view<operation::crc>(descriptors[first + i]);
+                const auto bypass_reflection =
+                    intersects(dsc.operation_specific_flags(), dml::detail::crc_specific_flag::bypass_crc_inversion_and_reflection);
+                const auto kernel =
+                    intersects(dsc.operation_specific_flags(), dml::detail::crc_specific_flag::bypass_data_reflection) ? 0u : 1u;
+                const auto slot = kernel_counts[kernel]++;
+
+                srcs[kernel][slot]    = reinterpret_cast<const byte_t *>(dsc.source_address());
+                sizes[kernel][slot]   = dsc.transfer_size();
+                crcs[kernel][slot]    = to_kernel_crc(dsc.crc_seed(), bypass_reflection);
+                entries[kernel][slot] = first + i;
+            }
+
+            dispatch::crc_multi(srcs[0], sizes[0], kernel_counts[0], crcs[0]);
+            dispatch::crc_multi_reflected(srcs[1], sizes[1], kernel_counts[1], crcs[1]);
+
+            for (uint32_t kernel = 0u; kernel < 2u; ++kernel)
+            {
+                for (uint32_t slot = 0u; slot < kernel_counts[kernel]; ++slot)
+                {
+                    const auto &entry  = descriptors[entries[kernel][slot]];
+                    auto        dsc    = make_view<operation::crc>(entry);
+                    auto        record = make_view<operation::crc>(get_completion_record(entry));
+                    const auto bypass_reflection =
+                        intersects(dsc.operation_specific_flags(), dml::detail::crc_specific_flag::bypass_crc_inversion_and_reflection);
+
+                    record.crc_value() = to_record_crc(crcs[kernel][slot], bypass_reflection);
+                }
+            }
+
+            _mm_mfence();
+
+            for (size_t i = 0u; i < group_count; ++i)
+            {
+                auto record = make_view<operation::crc>(get_completion_record(descriptors[first + i]));
+
+                record.status() = to_underlying(dml::detail::execution_status::success);
+            }
+        }
+    }
 }  // namespace dml::core::kernels
@@ -4,14 +4,12 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
-#include <dml_dif.h>
+#include <dif.hpp>
 
 #include <core/utils.hpp>
-#include <cstring>
 #include <dml/detail/common/status.hpp>
 #include <dml/detail/common/utils/enum.hpp>
 
-#include "../../../../include/dml/dmldefs.h"
 #include "immintrin.h"
 #include "kernels.hpp"
 
@@ -23,7 +21,6 @@ namespace dml::core::kernels
 
         const auto src              = reinterpret_cast<byte_t *>(dsc.source_address());
         const auto transfer_size    = dsc.transfer_size();
-        const auto options          = dsc.flags();
         const auto dif_options      = dsc.dif_flags();
         const auto dif_src_options  = dsc.source_dif_flags();
         const auto src_app_tag_mask = dsc.source_app_tag_mask();
@@ -31,29 +28,17 @@ namespace dml::core::kernels
         const auto src_ref_tag = dsc.source_ref_tag();
         const auto src_app_tag = dsc.source_app_tag();
 
-        dml_job_t job;
-        memset(&job, 0, sizeof(dml_job_t));
-        job.source_first_ptr                       = src;
-        job.source_length                          = transfer_size;
-        job.operation                              = DML_OP_DIF_CHECK;
-        job.dif_config.source_reference_tag_seed   = src_ref_tag;
-        job.dif_config.source_application_tag_seed = src_app_tag;
-        job.dif_config.source_application_tag_mask = src_app_tag_mask;
-        job.dif_config.block_size                  = static_cast<dml_dif_block_size_t>(dif_options & 0b11);
+        // DIF flags are composed into one value via shifting, check dmldefs.h
+        const auto flags = (uint32_t(dif_options) << 16) | dif_src_options;
 
-        // Job API composes DIF flags into one 64-bit value via shifting, check dmldefs.h
-        job.dif_config.flags = (uint64_t(dif_options) << 16) | dif_src_options;
+        const auto result = dif::check(src, transfer_size, flags, { src_ref_tag, src_app_tag, src_app_tag_mask });
 
-        job.flags = options;
-
-        auto status = dml_legacy_dif_check(&job);
-
-        record.dif_status()      = job.result;
-        record.bytes_completed() = job.offset;
+        record.dif_status()      = result.dif_status;
+        record.bytes_completed() = result.offset;
         // TODO: Tags should be written
 
         _mm_mfence();
-        record.status() = to_underlying((status == DML_STATUS_OK) ? dml::detail::execution_status::success
-                                                                  : dml::detail::execution_status::dif_control_error);
+        record.status() = to_underlying(result.success ? dml::detail::execution_status::success
+                                                       : dml::detail::execution_status::dif_control_error);
     }
 }  // namespace dml::core::kernels
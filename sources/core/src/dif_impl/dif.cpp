@@ -0,0 +1,329 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "dif.hpp"
+
+#include <dml/dmldefs.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <optimization_dispatcher.hpp>
+
+namespace dml::core::dif
+{
+    namespace
+    {
+        constexpr uint32_t block_sizes[] = { 512u, 520u, 4096u, 4104u };
+
+        constexpr uint32_t tuple_size = 8u;
+
+        // Guards of this many blocks are computed by one call, so the CRC engine can hash them in parallel
+        constexpr uint32_t batch_size = 32u;
+
+        // Fields of a tuple loaded as a little-endian word
+        constexpr uint64_t guard_field           = 0x000000000000FFFFu;
+        constexpr uint64_t application_tag_field = 0x00000000FFFF0000u;
+        constexpr uint64_t reference_tag_field   = 0xFFFFFFFF00000000u;
+
+        struct guard_options_t
+        {
+            uint16_t seed;
+            bool     invert_result;
+        };
+
+        auto get_block_size(uint32_t flags) noexcept
+        {
+            return block_sizes[(flags >> 16u) & 0b11u];
+        }
+
+        auto get_guard_options(uint32_t flags) noexcept -> guard_options_t
+        {
+            return { static_cast<uint16_t>((flags & DML_DIF_FLAG_INVERT_CRC_SEED) ? 0xFFFFu : 0u),
+                     static_cast<bool>(flags & DML_DIF_FLAG_INVERT_CRC_RESULT) };
+        }
+
+        auto load_tuple(const uint8_t* src) noexcept
+        {
+            uint64_t tuple = 0u;
+            std::memcpy(&tuple, src, tuple_size);
+
+            return tuple;
+        }
+
+        auto store_tuple(uint64_t tuple, uint8_t* dst) noexcept
+        {
+            std::memcpy(dst, &tuple, tuple_size);
+        }
+
+        auto byte_swap_16(uint16_t value) noexcept -> uint64_t
+        {
+            return static_cast<uint16_t>((value << 8u) | (value >> 8u));
+        }
+
+        auto byte_swap_32(uint32_t value) noexcept -> uint64_t
+        {
+            return (value << 24u) | ((value & 0xFF00u) << 8u) | ((value >> 8u) & 0xFF00u) | (value >> 24u);
+        }
+
+        /**
+         * @brief Returns a tuple with the big-endian fields loaded as a little-endian word
+         */
+        auto make_tuple(uint16_t crc, const guard_options_t& options, uint16_t application_tag, uint32_t reference_tag) noexcept
+        {
+            const auto guard = static_cast<uint16_t>(options.invert_result ? ~crc : crc);
+
+            return byte_swap_16(guard) | (byte_swap_16(application_tag) << 16u) | (byte_swap_32(reference_tag) << 32u);
+        }
+
+        /**
+         * @brief Verifies source tuples block by block, the tags it expects advance with every block
+         */
+        class tuple_checker_t
+        {
+        public:
+            tuple_checker_t(uint32_t flags, const tags_t& source_tags) noexcept
+                : flags_(flags),
+                  options_(get_guard_options(flags)),
+                  application_tag_mask_(static_cast<uint16_t>(~source_tags.application_tag_mask)),
+                  reference_tag_step_((flags & DML_DIF_FLAG_SRC_FIX_REF_TAG) ? 0u : 1u),
+                  application_tag_step_((flags & DML_DIF_FLAG_SRC_INC_APP_TAG) ? 1u : 0u),
+                  all_bits_set_error_((flags & DML_DIF_FLAG_SRC_F_DETECT_ALL) && (flags & DML_DIF_FLAG_SRC_F_ENABLE_ERROR)),
+                  reference_tag_(source_tags.reference_tag),
+                  application_tag_(source_tags.application_tag)
+            {
+                const auto check_application_tag = application_tag_mask_ != DML_MAX_16U;
+
+                // The expected tuple is compared with one masked word compare
+                checked_fields_ = ((flags & DML_DIF_FLAG_SRC_GUARD_CHECK_DISABLE) ? 0u : guard_field) |
+                                  (check_application_tag ? application_tag_field : 0u) |
+                                  ((flags & DML_DIF_FLAG_SRC_REF_TAG_CHECK_DISABLE) ? 0u : reference_tag_field);
+            }
+
+            [[nodiscard]] auto checks_guard() const noexcept
+            {
+                return (checked_fields_ & guard_field) != 0u;
+            }
+
+            /**
+             * @brief Returns the DIF status of the next block, zero if it passed
+             */
+            auto verify(uint64_t tuple, uint16_t crc) noexcept -> uint8_t
+            {
+                if (all_bits_set_error_ && tuple == DML_MAX_64U)
+                {
+                    return DML_DIF_CHECK_ALL_BITS_SET_DETECT_ERROR;
+                }
+
+                const auto application_tag_f = (tuple & application_tag_field) == application_tag_field;
+                const auto reference_tag_f   = (tuple & reference_tag_field) == reference_tag_field;
+                const auto skip_block        = ((flags_ & DML_DIF_FLAG_SRC_F_DETECT_TAGS) && application_tag_f && reference_tag_f) ||
+                                               ((flags_ & DML_DIF_FLAG_SRC_F_DETECT_APP_TAG) && application_tag_f);
+
+                uint64_t mismatch = 0u;
+
+                if (!skip_block)
+                {
+                    const auto expected =
+                        make_tuple(crc, options_, static_cast<uint16_t>(application_tag_ & application_tag_mask_), reference_tag_);
+
+                    mismatch = (tuple ^ expected) & checked_fields_;
+                }
+
+                reference_tag_ += reference_tag_step_;
+                application_tag_ += application_tag_step_;
+
+                return static_cast<uint8_t>(((mismatch & guard_field) ? DML_DIF_CHECK_GUARD_MISMATCH : 0u) |
+                                            ((mismatch & application_tag_field) ? DML_DIF_CHECK_APPLICATION_TAG_MISMATCH : 0u) |
+                                            ((mismatch & reference_tag_field) ? DML_DIF_CHECK_REFERENCE_TAG_MISMATCH : 0u));
+            }
+
+        private:
+            uint32_t        flags_;
+            guard_options_t options_;
+            uint16_t        application_tag_mask_;
+            uint32_t        reference_tag_step_;
+            uint16_t        application_tag_step_;
+            bool            all_bits_set_error_;
+            uint64_t        checked_fields_ = 0u;
+            uint32_t        reference_tag_;
+            uint16_t        application_tag_;
+        };
+    }  // namespace
+
+    auto check(const uint8_t* src, uint32_t transfer_size, uint32_t flags, const tags_t& source_tags) noexcept -> result_t
+    {
+        const auto block_size  = get_block_size(flags);
+        const auto step        = block_size + tuple_size;
+        const auto block_count = transfer_size / step;
+        const auto options     = get_guard_options(flags);
+
+        auto checker = tuple_checker_t(flags, source_tags);
+
+        uint16_t crcs[batch_size] = {};
+
+        for (uint32_t first = 0u; first < block_count; first += batch_size)
+        {
+            const auto count = std::min(batch_size, block_count - first);
+            const auto batch = src + static_cast<size_t>(first) * step;
+
+            if (checker.checks_guard())
+            {
+                dispatch::crc16_t10(batch, block_size, step, count, options.seed, crcs);
+            }
+
+            for (uint32_t block = 0u; block < count; ++block)
+            {
+                const auto dif_status = checker.verify(load_tuple(batch + static_cast<size_t>(block) * step + block_size), crcs[block]);
+
+                if (dif_status)
+                {
+                    return { false, dif_status, (first + block) * step };
+                }
+            }
+        }
+
+        return { true, 0u, 0u };
+    }
+
+    /*
+     * Operations with a destination copy each batch of blocks while hashing it, so the source is read once.
+     * A failed check leaves the blocks of its batch that follow the failed one copied, like the hardware may do
+     */
+
+    auto insert(const uint8_t* src, uint8_t* dst, uint32_t transfer_size, uint32_t flags, const tags_t& destination_tags) noexcept
+        -> result_t
+    {
+        const auto block_size  = get_block_size(flags);
+        const auto step        = block_size + tuple_size;
+        const auto block_count = transfer_size / block_size;
+        const auto options     = get_guard_options(flags);
+
+        const auto application_tag_mask = static_cast<uint16_t>(~destination_tags.application_tag_mask);
+        const auto reference_tag_step   = (flags & DML_DIF_FLAG_DST_FIX_REF_TAG) ? 0u : 1u;
+        const auto application_tag_step = (flags & DML_DIF_FLAG_DST_INC_APP_TAG) ? 1u : 0u;
+
+        auto reference_tag   = destination_tags.reference_tag;
+        auto application_tag = destination_tags.application_tag;
+
+        uint16_t crcs[batch_size];
+
+        for (uint32_t first = 0u; first < block_count; first += batch_size)
+        {
+            const auto count     = std::min(batch_size, block_count - first);
+            const auto src_batch = src + static_cast<size_t>(first) * block_size;
+            const auto dst_batch = dst + static_cast<size_t>(first) * step;
+
+            dispatch::copy_crc16_t10(src_batch, block_size, dst_batch, step, block_size, count, options.seed, crcs);
+
+            for (uint32_t block = 0u; block < count; ++block)
+            {
+                const auto tuple =
+                    make_tuple(crcs[block], options, static_cast<uint16_t>(application_tag & application_tag_mask), reference_tag);
+
+                store_tuple(tuple, dst_batch + static_cast<size_t>(block) * step + block_size);
+
+                reference_tag += reference_tag_step;
+                application_tag += application_tag_step;
+            }
+        }
+
+        return { true, 0u, 0u };
+    }
+
+    auto strip(const uint8_t* src, uint8_t* dst, uint32_t transfer_size, uint32_t flags, const tags_t& source_tags) noexcept -> result_t
+    {
+        const auto block_size  = get_block_size(flags);
+        const auto step        = block_size + tuple_size;
+        const auto block_count = transfer_size / step;
+        const auto options     = get_guard_options(flags);
+
+        auto checker = tuple_checker_t(flags, source_tags);
+
+        uint16_t crcs[batch_size];
+
+        for (uint32_t first = 0u; first < block_count; first += batch_size)
+        {
+            const auto count     = std::min(batch_size, block_count - first);
+            const auto src_batch = src + static_cast<size_t>(first) * step;
+            const auto dst_batch = dst + static_cast<size_t>(first) * block_size;
+
+            dispatch::copy_crc16_t10(src_batch, step, dst_batch, block_size, block_size, count, options.seed, crcs);
+
+            for (uint32_t block = 0u; block < count; ++block)
+            {
+                const auto dif_status = checker.verify(load_tuple(src_batch + static_cast<size_t>(block) * step + block_size), crcs[block]);
+
+                if (dif_status)
+                {
+                    return { false, dif_status, (first + block) * step };
+                }
+            }
+        }
+
+        return { true, 0u, 0u };
+    }
+
+    auto update(const uint8_t* src,
+                uint8_t*       dst,
+                uint32_t       transfer_size,
+                uint32_t       flags,
+                const tags_t&  source_tags,
+                const tags_t&  destination_tags) noexcept -> result_t
+    {
+        const auto block_size  = get_block_size(flags);
+        const auto step        = block_size + tuple_size;
+        const auto block_count = transfer_size / step;
+        const auto options     = get_guard_options(flags);
+
+        const auto application_tag_mask = static_cast<uint16_t>(~destination_tags.application_tag_mask);
+        const auto reference_tag_step   = (flags & DML_DIF_FLAG_DST_FIX_REF_TAG) ? 0u : 1u;
+        const auto application_tag_step = (flags & DML_DIF_FLAG_DST_INC_APP_TAG) ? 1u : 0u;
+
+        // Fields that are not passed from the source are replaced
+        const auto updated_fields = ((flags & DML_DIF_FLAG_DST_PASS_GUARD) ? 0u : guard_field) |
+                                    ((flags & DML_DIF_FLAG_DST_PASS_APP_TAG) ? 0u : application_tag_field) |
+                                    ((flags & DML_DIF_FLAG_DST_PASS_REF_TAG) ? 0u : reference_tag_field);
+
+        auto checker         = tuple_checker_t(flags, source_tags);
+        auto reference_tag   = destination_tags.reference_tag;
+        auto application_tag = destination_tags.application_tag;
+
+        uint16_t crcs[batch_size];
+
+        for (uint32_t first = 0u; first < block_count; first += batch_size)
+        {
+            const auto count     = std::min(batch_size, block_count - first);
+            const auto src_batch = src + static_cast<size_t>(first) * step;
+            const auto dst_batch = dst + static_cast<size_t>(first) * step;
+
+            // Both guards are computed with the same seed, so the source guard is also the destination one
+            dispatch::copy_crc16_t10(src_batch, step, dst_batch, step, block_size, count, options.seed, crcs);
+
+            for (uint32_t block = 0u; block < count; ++block)
+            {
+                const auto offset     = static_cast<size_t>(block) * step + block_size;
+                const auto tuple      = load_tuple(src_batch + offset);
+                const auto dif_status = checker.verify(tuple, crcs[block]);
+
+                if (dif_status)
+                {
+                    return { false, dif_status, (first + block) * step };
+                }
+
+                const auto expected =
+                    make_tuple(crcs[block], options, static_cast<uint16_t>(application_tag & application_tag_mask), reference_tag);
+
+                store_tuple((tuple & ~updated_fields) | (expected & updated_fields), dst_batch + offset);
+
+                reference_tag += reference_tag_step;
+                application_tag += application_tag_step;
+            }
+        }
+
+        return { true, 0u, 0u };
+    }
+}  // namespace dml::core::dif
@@ -0,0 +1,54 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef DML_CORE_DIF_HPP
+#define DML_CORE_DIF_HPP
+
+#include <cstdint>
+
+/**
+ * @brief T10 Data Integrity Field operations of the software path
+ * @details The flags argument holds the DIF flags, the destination DIF flags and the source DIF flags
+ *          in bits 16-23, 8-15 and 0-7, which is the layout of DML_DIF_FLAG_* values in dmldefs.h
+ */
+namespace dml::core::dif
+{
+    /**
+     * @brief Tags of the first block, bits set in the application tag mask are not checked or written
+     */
+    struct tags_t
+    {
+        uint32_t reference_tag;
+        uint16_t application_tag;
+        uint16_t application_tag_mask;
+    };
+
+    /**
+     * @brief Result of an operation, the offset is the source offset of the block that failed the check
+     */
+    struct result_t
+    {
+        bool     success;
+        uint8_t  dif_status;
+        uint32_t offset;
+    };
+
+    auto check(const uint8_t* src, uint32_t transfer_size, uint32_t flags, const tags_t& source_tags) noexcept -> result_t;
+
+    auto insert(const uint8_t* src, uint8_t* dst, uint32_t transfer_size, uint32_t flags, const tags_t& destination_tags) noexcept
+        -> result_t;
+
+    auto strip(const uint8_t* src, uint8_t* dst, uint32_t transfer_size, uint32_t flags, const tags_t& source_tags) noexcept -> result_t;
+
+    auto update(const uint8_t* src,
+                uint8_t*       dst,
+                uint32_t       transfer_size,
+                uint32_t       flags,
+                const tags_t&  source_tags,
+                const tags_t&  destination_tags) noexcept -> result_t;
+}  // namespace dml::core::dif
+
+#endif  // DML_CORE_DIF_HPP
@@ -5,6 +5,7 @@
  ******************************************************************************/
 
 #include <core/utils.hpp>
+#include <dml/detail/common/flags.hpp>
 #include <dml/detail/common/status.hpp>
 #include <dml/detail/common/utils/enum.hpp>
 #include <optimization_dispatcher.hpp>
@@ -23,7 +24,16 @@ namespace dml::core::kernels
         const auto dst2          = reinterpret_cast<byte_t *>(dsc.destination_2_address());
         const auto transfer_size = dsc.transfer_size();
 
-        dispatch::dualcast(src, dst1, dst2, transfer_size);
+        const auto cache_control = intersects(dsc.flags(), dml::detail::dualcast_flag::cache_control);
+
+        if (dispatch::is_non_temporal(transfer_size, cache_control))
+        {
+            dispatch::dualcast_non_temporal(src, dst1, dst2, transfer_size);
+        }
+        else
+        {
+            dispatch::dualcast(src, dst1, dst2, transfer_size);
+        }
 
         _mm_mfence();
         record.status() = to_underlying(dml::detail::execution_status::success);
@@ -5,12 +5,14 @@
  ******************************************************************************/
 
 #include <core/utils.hpp>
+#include <dml/detail/common/flags.hpp>
 #include <dml/detail/common/status.hpp>
 #include <dml/detail/common/utils/enum.hpp>
 #include <optimization_dispatcher.hpp>
 
 #include "immintrin.h"
 #include "kernels.hpp"
+#include "sw_engine/parallel_pool.hpp"
 
 namespace dml::core::kernels
 {
@@ -21,8 +23,15 @@ namespace dml::core::kernels
         const auto pattern       = dsc.pattern();
         const auto dst           = reinterpret_cast<byte_t *>(dsc.destination_address());
         const auto transfer_size = dsc.transfer_size();
+        const auto cache_control = intersects(dsc.flags(), dml::detail::fill_flag::cache_control);
+        const auto fill_chunk    = dispatch::is_non_temporal(transfer_size, cache_control) ? dispatch::fill_non_temporal : dispatch::fill;
 
-        dispatch::fill(pattern, dst, transfer_size);
+        // Chunks start at multiples of the pattern size, so the pattern phase is kept
+        const auto chunks = engine::parallel_pool::get_instance().split(transfer_size, engine::page_size);
+
+        engine::parallel_for(chunks,
+                             [pattern, dst, fill_chunk](std::uint32_t, std::uint32_t offset, std::uint32_t size)
+                             { fill_chunk(pattern, dst + offset, size); });
 
         _mm_mfence();
         record.status() = to_underlying(dml::detail::execution_status::success);
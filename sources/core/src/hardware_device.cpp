@@ -4,10 +4,15 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
+#include <algorithm>
+#include <array>
 #include <core/device.hpp>
 #include <core/utils.hpp>
+#include <functional>
 #include <limits>
+#include <thread>
 #include <dml/detail/common/status.hpp>
+#include <optimization_dispatcher.hpp>
 
 #include "hw_dispatcher/hw_dispatcher.hpp"
 #include "hw_dispatcher/numa.hpp"
@@ -34,36 +39,60 @@ namespace dml::core
     dml::detail::submission_status hardware_device::submit(const descriptor &dsc, std::uint32_t numa_id) noexcept
     {
 #if defined(__linux__)
-        const auto own_numa_id = (numa_id == std::numeric_limits<decltype(numa_id)>::max()) ? util::get_numa_id() : numa_id;
+        const auto own_numa_id = util::resolve_numa_id(dsc, numa_id);
 
         auto &dispatcher = dispatcher::hw_dispatcher::get_instance();
         const size_t device_count = dispatcher.device_count();
 
         if (dispatcher.is_hw_support())
         {
-            static thread_local auto current_device_idx = 0u;
-            size_t tried_devices = 0u;
+            // Devices with equal load are taken starting from a per-thread position, so threads spread over them
+            static thread_local auto rotation = static_cast<size_t>(std::hash<std::thread::id>()(std::this_thread::get_id()));
 
-            while (tried_devices < device_count)
+            const auto &placement = dispatcher.get_placement();
+
+            std::array<dispatcher::placement::device_state, MAX_DEVICE_COUNT> states{};
+            std::array<uint32_t, MAX_DEVICE_COUNT>                            order{};
+
+            size_t local_count = 0u;
+
+            for (size_t idx = 0u; idx < device_count; ++idx)
             {
-                const auto &current_device = dispatcher.device(current_device_idx);
-                current_device_idx = (current_device_idx + 1) % device_count;
+                const auto &device = dispatcher.device(idx);
 
-                if (own_numa_id != current_device.numa_id())
-                {
-                    tried_devices++;
-                    continue;
-                }
+                states[idx] = {device.numa_id(), device.load()};
+                local_count += (own_numa_id == device.numa_id()) ? 1u : 0u;
+            }
 
-                auto status = enqueue(current_device, dsc);
+            const auto count = placement.order(own_numa_id, states.data(), device_count, rotation++ % device_count, order.data());
 
-                if (status != dml::detail::submission_status::success)
+            // The spill policy keeps local devices first, they get the configured number of passes before remote ones
+            if (placement.get_policy() == dispatcher::placement::policy::spill)
+            {
+                for (uint32_t pass = 1u; pass < placement.spill_retries(); ++pass)
                 {
-                    tried_devices++;
+                    for (size_t i = 0u; i < local_count; ++i)
+                    {
+                        if (enqueue(dispatcher.device(order[i]), dsc) == dml::detail::submission_status::success)
+                        {
+                            return dml::detail::submission_status::success;
+                        }
+                    }
                 }
-                else
+            }
+
+            for (size_t i = 0u; i < count; ++i)
+            {
+                const auto &device = dispatcher.device(order[i]);
+
+                if (enqueue(device, dsc) == dml::detail::submission_status::success)
                 {
-                    return status;
+                    if (own_numa_id != device.numa_id())
+                    {
+                        dispatcher.account_spillover();
+                    }
+
+                    return dml::detail::submission_status::success;
                 }
             }
 
@@ -76,4 +105,37 @@ namespace dml::core
 
         return dml::detail::submission_status::failure;
     }
+
+    void hardware_device::release(const descriptor &dsc) noexcept
+    {
+#if defined(__linux__)
+        const auto *record_ptr = &get_completion_record(dsc);
+
+        // Records are usually waited for by the thread that submitted them, which remembers where they went
+        if (dispatcher::hw_device::release_placed_credit(record_ptr))
+        {
+            return;
+        }
+
+        for (const auto &device : dispatcher::hw_dispatcher::get_instance())
+        {
+            if (device.release_credit(record_ptr))
+            {
+                return;
+            }
+        }
+#else
+        static_cast<void>(dsc);
+#endif
+    }
+
+    dispatch::wait_estimate& hardware_device::wait_estimate(const descriptor& dsc) noexcept
+    {
+        // Nodes past the last slot share it, systems with that many nodes are rare
+        static std::array<dispatch::wait_estimate, 16u> estimates{};
+
+        const auto numa_id = util::resolve_numa_id(dsc, util::data_numa_id);
+
+        return estimates[std::min<size_t>(numa_id, estimates.size() - 1u)];
+    }
 }  // namespace dml::core
@@ -57,6 +57,8 @@ typedef int (*accfg_wq_get_user_dev_path_ptr)(struct accfg_wq *wq, char *buf, si
 
 typedef int (*accfg_wq_get_priority_ptr)(struct accfg_wq *wq);
 
+typedef int (*accfg_wq_get_size_ptr)(struct accfg_wq *wq);
+
 /**
  * @brief Table with functions required from accelerator configuration library
  */
@@ -83,6 +85,7 @@ static dsa_desc_t functions_table[] = { { NULL, "accfg_new" },
                                         { NULL, "accfg_wq_get_group_id" },
                                         { NULL, "accfg_group_get_id" },
                                         { NULL, "accfg_wq_get_user_dev_path" },
+                                        { NULL, "accfg_wq_get_size" },
                                         // Terminate list/init
                                         { NULL, NULL } };
 
@@ -338,6 +341,15 @@ int DML_HW_API(work_queue_get_device_path)(struct accfg_wq *wq, char *buf, size_
 #endif
 }
 
+int DML_HW_API(work_queue_get_size)(struct accfg_wq *wq)
+{
+#if defined(__linux__)
+    return ((accfg_wq_get_size_ptr)functions_table[23].function)(wq);
+#else
+    return -1;
+#endif
+}
+
 #if defined(__linux__)
 
 /* ------ Internal functions implementation ------ */
@@ -11,7 +11,11 @@
 #include "hw_device.hpp"
 
 #include <algorithm>
+#include <functional>
+#include <limits>
+#include <thread>
 
+#include "hw_simulator.hpp"
 #include "legacy_headers/hardware_configuration_driver.h"
 #include "legacy_headers/own_dsa_accel_constants.h"
 
@@ -51,45 +55,122 @@ namespace dml::core::dispatcher
         hw_context_ptr->gen_cap.configuration_support        = hw_device::configuration_support();
     }
 
+    namespace
+    {
+        /**
+         * @brief Dedicated queue and slot a thread placed a completion record in
+         */
+        struct placed_record
+        {
+            const void     *record_ptr = nullptr;
+            const hw_queue *queue_ptr  = nullptr;
+            uint32_t        slot       = 0u;
+        };
+
+        /**
+         * @brief Returns the entry of the record in the records placed by this thread, records are usually waited for by their submitter
+         */
+        auto placed_record_of(const void *record_ptr) noexcept -> placed_record &
+        {
+            static thread_local std::array<placed_record, 64u> placed_records{};
+
+            return placed_records[(reinterpret_cast<uintptr_t>(record_ptr) >> 5u) % placed_records.size()];
+        }
+
+        /**
+         * @brief Returns the position of the calling thread among the submitting ones
+         */
+        auto thread_index() noexcept -> uint32_t
+        {
+            static std::atomic<uint32_t>       thread_count{0u};
+            static thread_local const uint32_t index = thread_count.fetch_add(1u, std::memory_order_relaxed);
+
+            return index;
+        }
+    }  // namespace
+
+    auto hw_device::enqueue_to(const hw_queue &queue, const dsahw_descriptor_t *desc_ptr) const noexcept -> dsahw_status_t
+    {
+        if (hw_queue::submission_mode::dedicated != queue.mode())
+        {
+            return queue.enqueue_descriptor(desc_ptr);
+        }
+
+        const auto *record_ptr = hw_queue::completion_record_of(desc_ptr);
+        auto       &placed     = placed_record_of(record_ptr);
+
+        // A record submitted again was waited for without the library, its previous descriptor is done
+        if (placed.record_ptr == record_ptr)
+        {
+            placed.queue_ptr->release_credit(record_ptr, placed.slot);
+            placed = placed_record();
+        }
+
+        uint32_t slot = 0u;
+
+        if (DML_STATUS_OK != queue.enqueue_dedicated(desc_ptr, slot))
+        {
+            return DML_STATUS_WORK_QUEUE_OVERFLOW_ERROR;
+        }
+
+        placed = placed_record{record_ptr, &queue, slot};
+
+        return DML_STATUS_OK;
+    }
+
     /**
      * @brief Choose queue for descriptor submission on current device.
      *
-     * Go through all available queues on the device in circular fashion:
-     * start from the queue that is right after the one used for previous submission
-     * , and then trying to submit until we reach the one that was used previously.
+     * Every thread has a home dedicated queue, so submitters do not contend for the credits of one queue.
+     * The rest of the queues are tried only when the home one has no credit.
      *
-     * Currently for multi-threaded execution,
-     * each thread would be starting from the same place,
-     * and keeping track in its own copy of last_wq_idx.
+     * The least loaded queue is tried first, then the rest of them in circular fashion.
+     * Queue load counts recent submissions and retries, so a queue that rejects descriptors
+     * is avoided until it drains.
      *
-     * @todo Investigate other thread balancing strategies.
+     * Queues with equal load are taken starting from a per-thread position,
+     * so threads submitting at the same time do not pile onto the same queue.
      */
     auto hw_device::enqueue_descriptor(const dsahw_descriptor_t *desc_ptr) const noexcept -> dsahw_status_t
     {
-        const uint32_t n_queues = std::distance(this->begin(), this->end());
+        const uint32_t n_queues = queue_count_;
 
-        static thread_local uint32_t last_wq_idx = n_queues - 1;
+        auto home_idx = n_queues;
 
-        for (auto idx = last_wq_idx + 1; idx < n_queues; ++idx)
+        if (0u != dedicated_count_)
         {
-            auto &queue = *(this->begin() + idx);
-            auto status = queue.enqueue_descriptor(desc_ptr);
+            home_idx = dedicated_queues_[thread_index() % dedicated_count_];
 
-            if (DML_STATUS_OK == status)
+            if (DML_STATUS_OK == enqueue_to(working_queues_[home_idx], desc_ptr))
             {
-                last_wq_idx = idx;
                 return DML_STATUS_OK;
             }
         }
 
-        for (auto idx = 0; idx <= last_wq_idx; ++idx)
+        static thread_local uint32_t rotation = static_cast<uint32_t>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+
+        const auto start     = rotation++ % n_queues;
+        auto       best_idx  = start;
+        auto       best_load = std::numeric_limits<uint32_t>::max();
+
+        for (uint32_t i = 0u; i < n_queues; ++i)
+        {
+            const auto idx  = (start + i) % n_queues;
+            const auto load = working_queues_[idx].load();
+
+            if (load < best_load)
+            {
+                best_idx  = idx;
+                best_load = load;
+            }
+        }
+
+        for (uint32_t i = 0u; i < n_queues; ++i)
         {
-            auto &queue = *(this->begin() + idx);
-            auto status = queue.enqueue_descriptor(desc_ptr);
+            const auto idx = (best_idx + i) % n_queues;
 
-            if (DML_STATUS_OK == status)
+            if (idx != home_idx && DML_STATUS_OK == enqueue_to(working_queues_[idx], desc_ptr))
             {
-                last_wq_idx = idx;
                 return DML_STATUS_OK;
             }
         }
@@ -97,6 +178,60 @@ namespace dml::core::dispatcher
         return DML_STATUS_WORK_QUEUE_OVERFLOW_ERROR;
     }
 
+    auto hw_device::release_placed_credit(const void *record_ptr) noexcept -> bool
+    {
+        auto &placed = placed_record_of(record_ptr);
+
+        if (placed.record_ptr != record_ptr)
+        {
+            return false;
+        }
+
+        const auto released = placed.queue_ptr->release_credit(record_ptr, placed.slot);
+
+        placed = placed_record();
+
+        return released;
+    }
+
+    auto hw_device::release_credit(const void *record_ptr) const noexcept -> bool
+    {
+        for (uint32_t i = 0u; i < dedicated_count_; ++i)
+        {
+            if (working_queues_[dedicated_queues_[i]].release_credit(record_ptr))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void hw_device::index_dedicated_queues() noexcept
+    {
+        dedicated_count_ = 0u;
+
+        for (uint32_t i = 0u; i < queue_count_; ++i)
+        {
+            if (hw_queue::submission_mode::dedicated == working_queues_[i].mode())
+            {
+                dedicated_queues_[dedicated_count_++] = i;
+            }
+        }
+    }
+
+    auto hw_device::load() const noexcept -> uint32_t
+    {
+        auto min_load = std::numeric_limits<uint32_t>::max();
+
+        for (const auto &queue : *this)
+        {
+            min_load = std::min(min_load, queue.load());
+        }
+
+        return min_load;
+    }
+
     auto hw_device::block_on_fault_support() const noexcept -> uint8_t
     {
         return GC_BLOCK_ON_FAULT(gen_cap_register_);
@@ -227,12 +362,42 @@ namespace dml::core::dispatcher
             return DML_STATUS_WORK_QUEUES_NOT_AVAILABLE;
         }
 
+        index_dedicated_queues();
+
         return DML_STATUS_OK;
 #else
         return DML_STATUS_WORK_QUEUES_NOT_AVAILABLE;
 #endif
     }
 
+    auto hw_device::initialize_simulated_device(simulated_device &device) noexcept -> dsahw_status_t
+    {
+        // Block on fault, overlapping copy and both cache controls, 2^31 bytes per transfer and 2^10 descriptors per batch
+        constexpr uint64_t simulated_gen_cap = 0b1111u | (uint64_t(31u) << 16u) | (uint64_t(10u) << 21u);
+
+        gen_cap_register_ = simulated_gen_cap;
+        numa_node_id_     = device.numa_id();
+        version_major_    = 1u;
+        version_minor_    = 0u;
+        queue_count_      = 0u;
+
+        for (size_t i = 0u; i < device.portal_count() && queue_count_ < max_working_queues; ++i)
+        {
+            auto &portal = device.portal(i);
+
+            if (DML_STATUS_OK == working_queues_[queue_count_].configure(&portal, hw_queue::submission_mode::simulated, portal.size(), 0))
+            {
+                ++queue_count_;
+            }
+        }
+
+        index_dedicated_queues();
+
+        DIAG("simulated device: numa: %lu, queues: %u\n", numa_node_id_, queue_count_);
+
+        return (queue_count_ == 0u) ? DML_STATUS_WORK_QUEUES_NOT_AVAILABLE : DML_STATUS_OK;
+    }
+
     auto hw_device::size() const noexcept -> size_t
     {
         return queue_count_;
@@ -18,6 +18,7 @@
 
 namespace dml::core::dispatcher
 {
+    class simulated_device;
 
     class hw_device final
     {
@@ -34,12 +35,31 @@ namespace dml::core::dispatcher
 
         [[nodiscard]] auto enqueue_descriptor(const dsahw_descriptor_t *desc_ptr) const noexcept -> dsahw_status_t;
 
+        /**
+         * @brief Returns the dedicated queue credit of a record from the queue and slot the calling thread placed it in
+         *
+         * Returns false if the record was not submitted by this thread or was released already.
+         */
+        static auto release_placed_credit(const void *record_ptr) noexcept -> bool;
+
+        /**
+         * @brief Returns the dedicated queue credit of a record submitted by another thread, see @ref hw_queue::release_credit
+         */
+        auto release_credit(const void *record_ptr) const noexcept -> bool;
+
         [[nodiscard]] auto initialize_new_device(descriptor_t *device_descriptor_ptr) noexcept -> dsahw_status_t;
 
+        /**
+         * @brief Sets up the device over a simulated one, with a queue for every simulated portal
+         */
+        [[nodiscard]] auto initialize_simulated_device(simulated_device &device) noexcept -> dsahw_status_t;
+
         [[nodiscard]] auto size() const noexcept -> size_t;
 
         [[nodiscard]] auto numa_id() const noexcept -> uint64_t;
 
+        [[nodiscard]] auto load() const noexcept -> uint32_t;
+
         [[nodiscard]] auto begin() const noexcept -> queues_container_t::const_iterator;
 
         [[nodiscard]] auto end() const noexcept -> queues_container_t::const_iterator;
@@ -66,12 +86,18 @@ namespace dml::core::dispatcher
         auto configuration_support() const noexcept -> uint8_t;
 
     private:
-        queues_container_t working_queues_   = {}; /**< Set of available HW working queues */
-        uint32_t           queue_count_      = 0u; /**< Number of working queues that are available */
-        uint64_t           gen_cap_register_ = 0u; /**< GENCAP register content */
-        uint64_t           numa_node_id_     = 0u; /**< NUMA node id of the device */
-        uint32_t           version_major_    = 0u; /**< Major version of discovered device */
-        uint32_t           version_minor_    = 0u; /**< Minor version of discovered device */
+        [[nodiscard]] auto enqueue_to(const hw_queue &queue, const dsahw_descriptor_t *desc_ptr) const noexcept -> dsahw_status_t;
+
+        void index_dedicated_queues() noexcept;
+
+        queues_container_t                        working_queues_   = {}; /**< Set of available HW working queues */
+        uint32_t                                  queue_count_      = 0u; /**< Number of working queues that are available */
+        std::array<uint32_t, max_working_queues>  dedicated_queues_ = {}; /**< Indices of dedicated queues, threads are spread over them */
+        uint32_t                                  dedicated_count_  = 0u; /**< Number of dedicated queues */
+        uint64_t                                  gen_cap_register_ = 0u; /**< GENCAP register content */
+        uint64_t                                  numa_node_id_     = 0u; /**< NUMA node id of the device */
+        uint32_t                                  version_major_    = 0u; /**< Major version of discovered device */
+        uint32_t                                  version_minor_    = 0u; /**< Minor version of discovered device */
     };
 
 }  // namespace dml::core::dispatcher
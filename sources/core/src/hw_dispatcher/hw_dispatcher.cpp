@@ -8,6 +8,8 @@
 
 #if defined(__linux__)
 
+#include "hw_simulator.hpp"
+#include "numa.hpp"
 #include "legacy_headers/libaccel_config.h"
 
 #endif
@@ -28,6 +30,7 @@ namespace dml::core::dispatcher
 #if defined(__linux__)
         hw_init_status_ = hw_dispatcher::initialize_hw();
         hw_support_     = hw_init_status_ == DML_STATUS_OK;
+        placement_      = placement::from_environment();
 #else
         hw_support_ = false;
 #endif
@@ -42,6 +45,11 @@ namespace dml::core::dispatcher
         DIAG("DML version %s\n", "TODO");
         DIAG("Struct size: %lu B\n", sizeof(device_container_t));
 
+        if (is_simulation_enabled())
+        {
+            return initialize_simulation();
+        }
+
         dsahw_status_t status = dsa_initialize_accelerator_driver(&hw_driver_);
         DML_HWSTS_RET(status != DML_STATUS_OK, status);
 
@@ -76,6 +84,51 @@ namespace dml::core::dispatcher
 
         return DML_STATUS_OK;
     }
+
+    auto hw_dispatcher::initialize_simulation() noexcept -> dsahw_status_t
+    {
+        const auto config = simulation_config::from_environment();
+
+        // Devices are put on every node that has CPUs
+        std::vector<uint64_t> nodes;
+
+        const auto cpu_lists = util::read_numa_node_files("cpulist");
+
+        for (uint64_t id = 0u; id < cpu_lists.size(); ++id)
+        {
+            if (!cpu_lists[id].empty())
+            {
+                nodes.push_back(id);
+            }
+        }
+
+        if (nodes.empty())
+        {
+            nodes.push_back(util::get_numa_id());
+        }
+
+        DIAG("simulating %u device(s) per node on %zu node(s)\n", config.devices_per_node, nodes.size());
+
+        for (uint32_t i = 0u; i < config.devices_per_node; ++i)
+        {
+            for (auto node : nodes)
+            {
+                if (device_count_ == max_devices)
+                {
+                    break;
+                }
+
+                auto &device = *simulated_devices_.emplace_back(std::make_unique<simulated_device>(config, node));
+
+                if (DML_STATUS_OK == devices_[device_count_].initialize_simulated_device(device))
+                {
+                    ++device_count_;
+                }
+            }
+        }
+
+        return (device_count_ == 0u) ? DML_STATUS_WORK_QUEUES_NOT_AVAILABLE : DML_STATUS_OK;
+    }
 #endif
 
     hw_dispatcher::~hw_dispatcher() noexcept
@@ -146,6 +199,21 @@ namespace dml::core::dispatcher
         return devices_[idx % device_count_];
     }
 
+    auto hw_dispatcher::get_placement() const noexcept -> const placement &
+    {
+        return placement_;
+    }
+
+    void hw_dispatcher::account_spillover() const noexcept
+    {
+        spillover_count_.fetch_add(1u, std::memory_order_relaxed);
+    }
+
+    auto hw_dispatcher::spillover_count() const noexcept -> uint64_t
+    {
+        return spillover_count_.load(std::memory_order_relaxed);
+    }
+
     void hw_dispatcher::hw_context::set_driver_context_ptr(accfg_ctx *driver_context_ptr) noexcept
     {
         driver_context_ptr_ = driver_context_ptr;
@@ -8,10 +8,14 @@
 #define DML_MIDDLE_LAYER_DISPATCHER_HW_DISPATCHER_HPP_
 
 #include <array>
+#include <atomic>
 #include <cstdint>
+#include <memory>
+#include <vector>
 
 #include "dml/dmldefs.h"
 #include "hw_device.hpp"
+#include "placement.hpp"
 
 #if defined(__linux__)
 #include "legacy_headers/hardware_configuration_driver.h"
@@ -66,6 +70,18 @@ namespace dml::core::dispatcher
 
         [[nodiscard]] auto device(size_t idx) const noexcept -> const hw_device &;
 
+        [[nodiscard]] auto get_placement() const noexcept -> const placement &;
+
+        /**
+         * @brief Counts a descriptor submitted to a device on another NUMA node than the submitter
+         */
+        void account_spillover() const noexcept;
+
+        /**
+         * @brief Returns number of descriptors submitted to a remote node, an internal counter read by the benchmarks only
+         */
+        [[nodiscard]] auto spillover_count() const noexcept -> uint64_t;
+
 #endif
 
         virtual ~hw_dispatcher() noexcept;
@@ -76,11 +92,19 @@ namespace dml::core::dispatcher
 #if defined(__linux__)
         auto initialize_hw() noexcept -> dsahw_status_t;
 
+        /**
+         * @brief Creates simulated devices instead of the real ones, see @ref is_simulation_enabled
+         */
+        auto initialize_simulation() noexcept -> dsahw_status_t;
+
     private:
-        hw_context         hw_context_;
-        hw_driver_t        hw_driver_{};
-        device_container_t devices_{};
-        size_t             device_count_ = 0;
+        hw_context                                     hw_context_;
+        hw_driver_t                                    hw_driver_{};
+        std::vector<std::unique_ptr<simulated_device>> simulated_devices_;
+        device_container_t                             devices_{};
+        size_t                                         device_count_ = 0;
+        placement                                      placement_;
+        mutable std::atomic<uint64_t>                  spillover_count_{0u};
 #endif
 
         bool hw_support_;
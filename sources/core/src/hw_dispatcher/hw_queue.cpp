@@ -14,7 +14,13 @@
 
 #endif
 
+#include <x86intrin.h>
+
+#include <algorithm>
+
+#include "../sw_dispatcher/dml_cpuid.h"
 #include "hw_queue.hpp"
+#include "hw_simulator.hpp"
 #include "legacy_headers/hardware_configuration_driver.h"
 #include "legacy_headers/own_dsa_accel_constants.h"
 
@@ -26,6 +32,38 @@
         }                             \
     }
 
+namespace
+{
+    /**
+     * Load is kept with the time it was updated at, in units that are about a typical descriptor latency.
+     * Load halves every unit, so it approximates the number of descriptors still in flight.
+     */
+    constexpr uint32_t load_time_shift  = 13u; /**< 8k cycles per unit */
+    constexpr uint32_t load_value_bits  = 16u;
+    constexpr uint64_t load_value_mask  = (uint64_t(1u) << load_value_bits) - 1u;
+    constexpr uint64_t submission_load  = 16u;  /**< Weight of an accepted descriptor */
+    constexpr uint64_t retry_load       = 128u; /**< Weight of a retry, the queue was full */
+
+    inline uint64_t load_time() noexcept
+    {
+        return __rdtsc() >> load_time_shift;
+    }
+
+    inline uint64_t decayed_load(uint64_t state, uint64_t now) noexcept
+    {
+        const auto elapsed = now - (state >> load_value_bits);
+
+        return (elapsed >= load_value_bits) ? 0u : (state & load_value_mask) >> elapsed;
+    }
+
+    inline bool is_movdir64b_supported() noexcept
+    {
+        static const bool supported = (dml_core_cpuidex(DML_CPUID_EXTENSIONS, 0u).ecx & DML_MOVDIR64B) == DML_MOVDIR64B;
+
+        return supported;
+    }
+}  // namespace
+
 namespace dml::core::dispatcher
 {
     hw_queue::hw_queue(hw_queue &&other) noexcept
@@ -35,6 +73,8 @@ namespace dml::core::dispatcher
         portal_mask_   = other.portal_mask_;
         portal_ptr_    = other.portal_ptr_;
         portal_offset_ = 0;
+        mode_          = other.mode_;
+        size_          = other.size_;
 
         other.portal_ptr_ = nullptr;
     }
@@ -47,7 +87,9 @@ namespace dml::core::dispatcher
             portal_mask_   = other.portal_mask_;
             portal_ptr_    = other.portal_ptr_;
             portal_offset_ = 0;
-            
+            mode_          = other.mode_;
+            size_          = other.size_;
+
             other.portal_ptr_ = nullptr;
         }
 
@@ -57,8 +99,8 @@ namespace dml::core::dispatcher
     hw_queue::~hw_queue()
     {
 #if defined(__linux__)
-        // Freeing resources
-        if (portal_ptr_ != nullptr)
+        // Freeing resources, simulated portals belong to their device
+        if (portal_ptr_ != nullptr && submission_mode::simulated != mode_)
         {
             munmap(portal_ptr_, 0x1000u);
 
@@ -84,6 +126,22 @@ namespace dml::core::dispatcher
     auto hw_queue::enqueue_descriptor(const dsahw_descriptor_t *desc_ptr) const noexcept -> dsahw_status_t
     {
 #if defined(__linux__)
+        if (submission_mode::dedicated == mode_)
+        {
+            uint32_t slot = 0u;
+
+            return enqueue_dedicated(desc_ptr, slot);
+        }
+
+        if (submission_mode::simulated == mode_)
+        {
+            const auto accepted = static_cast<simulated_portal *>(portal_ptr_)->submit(desc_ptr);
+
+            account_submission(!accepted);
+
+            return accepted ? DML_STATUS_OK : DML_STATUS_WORK_QUEUE_OVERFLOW_ERROR;
+        }
+
         uint8_t retry = 0u;
 
         void *current_place_ptr = get_portal_ptr();
@@ -93,12 +151,126 @@ namespace dml::core::dispatcher
                      : "=r"(retry)
                      : "a"(current_place_ptr), "d"(desc_ptr));
 
+        account_submission(retry != 0u);
+
         return static_cast<dsahw_status_t>(retry);
 #else
         return DML_STATUS_WORK_QUEUES_NOT_AVAILABLE;
 #endif
     }
 
+    auto hw_queue::enqueue_dedicated(const dsahw_descriptor_t *desc_ptr, uint32_t &slot) const noexcept -> dsahw_status_t
+    {
+        const auto *record_ptr = completion_record_of(desc_ptr);
+
+        if (!take_credit(record_ptr, slot))
+        {
+            account_submission(true);
+
+            return DML_STATUS_WORK_QUEUE_OVERFLOW_ERROR;
+        }
+
+        void *current_place_ptr = get_portal_ptr();
+        asm volatile("sfence\t\n"
+                     ".byte 0x66, 0x0f, 0x38, 0xf8, 0x02\t\n"
+                     :
+                     : "a"(current_place_ptr), "d"(desc_ptr)
+                     : "memory");
+
+        account_submission(false);
+
+        return DML_STATUS_OK;
+    }
+
+    auto hw_queue::completion_record_of(const dsahw_descriptor_t *desc_ptr) noexcept -> const void *
+    {
+        constexpr uint32_t completion_record_address_offset = 8u;
+
+        return *reinterpret_cast<const void *const *>(desc_ptr->bytes + completion_record_address_offset);
+    }
+
+    auto hw_queue::home_slot(const void *record_ptr) const noexcept -> uint32_t
+    {
+        // Records are at least 32 bytes apart
+        return static_cast<uint32_t>((reinterpret_cast<uintptr_t>(record_ptr) >> 5u) % size_);
+    }
+
+    auto hw_queue::take_credit(const void *record_ptr, uint32_t &slot) const noexcept -> bool
+    {
+        if (in_flight_count_.fetch_add(1u, std::memory_order_acq_rel) >= size_)
+        {
+            in_flight_count_.fetch_sub(1u, std::memory_order_acq_rel);
+
+            return false;
+        }
+
+        // Fewer slots than the reserved credits are taken, so a free one is found, possibly after a slot is released
+        for (uint32_t i = home_slot(record_ptr);; i = (i + 1u) % size_)
+        {
+            const void *expected = nullptr;
+
+            if (in_flight_[i].compare_exchange_strong(expected, record_ptr, std::memory_order_acq_rel))
+            {
+                slot = i;
+
+                return true;
+            }
+        }
+    }
+
+    auto hw_queue::release_credit(const void *record_ptr, uint32_t slot) const noexcept -> bool
+    {
+        const void *expected = record_ptr;
+
+        if (slot >= size_ || !in_flight_[slot].compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel))
+        {
+            return false;
+        }
+
+        in_flight_count_.fetch_sub(1u, std::memory_order_acq_rel);
+
+        return true;
+    }
+
+    auto hw_queue::release_credit(const void *record_ptr) const noexcept -> bool
+    {
+        // Slots free up in any order, so the record may be anywhere after its home slot
+        const auto home = home_slot(record_ptr);
+
+        for (uint32_t i = 0u; i < size_; ++i)
+        {
+            if (release_credit(record_ptr, (home + i) % size_))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    auto hw_queue::configure(void *portal_ptr, submission_mode mode, uint32_t size, int32_t priority) noexcept -> dsahw_status_t
+    {
+        if (submission_mode::dedicated == mode && (0u == size || max_dedicated_size < size || !is_movdir64b_supported()))
+        {
+            return DML_STATUS_WORK_QUEUES_NOT_AVAILABLE;
+        }
+
+        mode_     = mode;
+        size_     = size;
+        priority_ = priority;
+
+        for (auto &record_ptr : in_flight_)
+        {
+            record_ptr.store(nullptr, std::memory_order_relaxed);
+        }
+
+        in_flight_count_.store(0u, std::memory_order_relaxed);
+
+        hw_queue::set_portal_ptr(portal_ptr);
+
+        return DML_STATUS_OK;
+    }
+
     auto hw_queue::initialize_new_queue(void *wq_descriptor_ptr) noexcept -> dsahw_status_t
     {
 #if defined(__linux__)
@@ -114,12 +286,17 @@ namespace dml::core::dispatcher
             return DML_STATUS_WORK_QUEUES_NOT_AVAILABLE;
         }
 
-        if (ACCFG_WQ_SHARED != dsa_work_queue_get_mode(work_queue_ptr))
+        const auto wq_mode = dsa_work_queue_get_mode(work_queue_ptr);
+
+        if (ACCFG_WQ_SHARED != wq_mode && (ACCFG_WQ_DEDICATED != wq_mode || !is_movdir64b_supported()))
         {
             DIAG("     %7s: UNSUPPORTED\n", work_queue_dev_name);
             return DML_STATUS_WORK_QUEUES_NOT_AVAILABLE;
         }
 
+        const auto mode = (ACCFG_WQ_SHARED == wq_mode) ? submission_mode::shared : submission_mode::dedicated;
+        const auto size = dsa_work_queue_get_size(work_queue_ptr);
+
         DIAG("     %7s:\n", work_queue_dev_name);
         auto status = dsa_work_queue_get_device_path(work_queue_ptr, path, 64 - 1);
 
@@ -133,7 +310,7 @@ namespace dml::core::dispatcher
             return DML_STATUS_LIBACCEL_ERROR;
         }
 
-        // Map portal for enqcmd
+        // Map portal for enqcmd or movdir64b
         auto *region_ptr = mmap(nullptr, 0x1000u, PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, 0u);
         close(fd);
         if(MAP_FAILED == region_ptr)
@@ -148,10 +325,16 @@ namespace dml::core::dispatcher
             return DML_STATUS_LIBACCEL_ERROR;
         }
 
-        priority_    = dsa_work_queue_get_priority(work_queue_ptr);
         memory_type_ = dsa_group_get_traffic_class_b(group_ptr) ? supported_memory_type::durable
                                                                 : supported_memory_type::non_durable;
 
+        if (DML_STATUS_OK != configure(region_ptr, mode, static_cast<uint32_t>(std::max(size, 0)), dsa_work_queue_get_priority(work_queue_ptr)))
+        {
+            DIAG("     %7s: unsupported size: %d\n", work_queue_dev_name, size);
+            munmap(region_ptr, 0x1000u);
+            return DML_STATUS_WORK_QUEUES_NOT_AVAILABLE;
+        }
+
 #if 0
     DIAG("     %7s: size:        %d\n", work_queue_dev_name, accfg_wq_get_size(work_queue_ptr));
     DIAG("     %7s: threshold:   %d\n", work_queue_dev_name, accfg_wq_get_threshold(work_queue_ptr));
@@ -168,10 +351,10 @@ namespace dml::core::dispatcher
 #else
         DIAG("     %7s: priority:    %d\n", work_queue_dev_name, priority_);
         DIAG("     %7s: memtype:     %d\n", work_queue_dev_name, static_cast<int>(memory_type_));
+        DIAG("     %7s: mode:        %s\n", work_queue_dev_name, (submission_mode::shared == mode_) ? "shared" : "dedicated");
+        DIAG("     %7s: size:        %u\n", work_queue_dev_name, size_);
 #endif
 
-        hw_queue::set_portal_ptr(region_ptr);
-
         return DML_STATUS_OK;
 #else
         return DML_STATUS_WORK_QUEUES_NOT_AVAILABLE;
@@ -183,11 +366,47 @@ namespace dml::core::dispatcher
         return priority_;
     }
 
+    auto hw_queue::load() const noexcept -> uint32_t
+    {
+        return static_cast<uint32_t>(decayed_load(load_state_.load(std::memory_order_relaxed), load_time()));
+    }
+
+    auto hw_queue::retry_count() const noexcept -> uint64_t
+    {
+        return retry_count_.load(std::memory_order_relaxed);
+    }
+
+    void hw_queue::account_submission(bool retry) const noexcept
+    {
+        // Updates from concurrent submitters may be lost, which only makes the estimate a bit lower
+        const auto now  = load_time();
+        const auto load = std::min(decayed_load(load_state_.load(std::memory_order_relaxed), now) + (retry ? retry_load : submission_load),
+                                   load_value_mask);
+
+        load_state_.store((now << load_value_bits) | load, std::memory_order_relaxed);
+
+        if (retry)
+        {
+            retry_count_.fetch_add(1u, std::memory_order_relaxed);
+        }
+    }
+
     auto hw_queue::memory_type() const noexcept -> hw_queue::supported_memory_type
     {
         return memory_type_;
     }
 
+    auto hw_queue::mode() const noexcept -> hw_queue::submission_mode
+    {
+        return mode_;
+    }
+
+    auto hw_queue::credits() const noexcept -> uint32_t
+    {
+        // Failed reservations may briefly count past the size
+        return size_ - std::min(in_flight_count_.load(std::memory_order_relaxed), size_);
+    }
+
 }  // namespace dml::core::dispatcher
 
 #endif
@@ -7,6 +7,7 @@
 #ifndef DML_MIDDLE_LAYER_DISPATCHER_HW_QUEUE_HPP_
 #define DML_MIDDLE_LAYER_DISPATCHER_HW_QUEUE_HPP_
 
+#include <array>
 #include <atomic>
 
 #include "dml/dmldefs.h"
@@ -27,6 +28,18 @@ namespace dml::core::dispatcher
             non_durable
         };
 
+        enum class submission_mode
+        {
+            shared,   /**< Descriptors are submitted with ENQCMD, the device rejects them when the queue is full */
+            dedicated, /**< Descriptors are submitted with MOVDIR64B, the library keeps the queue from overflowing */
+            simulated  /**< Descriptors are submitted to a @ref simulated_portal, which rejects them when the queue is full */
+        };
+
+        /**
+         * @brief Maximal size of a dedicated queue, that is number of descriptors it can hold
+         */
+        static constexpr uint32_t max_dedicated_size = 128u;
+
         using descriptor_t = void;
 
         hw_queue() noexcept = default;
@@ -41,25 +54,96 @@ namespace dml::core::dispatcher
 
         auto initialize_new_queue(descriptor_t *wq_descriptor_ptr) noexcept -> dsahw_status_t;
 
+        /**
+         * @brief Sets up the queue over a mapped portal
+         *
+         * Called by @ref initialize_new_queue, a portal in regular memory simulates the device.
+         *
+         * @param portal_ptr Page mapped for submission, the queue unmaps it on destruction.
+         *                   Pointer to a @ref simulated_portal for the simulated mode
+         * @param mode       Submission mode of the queue
+         * @param size       Number of descriptors a dedicated queue holds
+         * @param priority   Priority of the queue
+         */
+        auto configure(void *portal_ptr, submission_mode mode, uint32_t size, int32_t priority) noexcept -> dsahw_status_t;
+
         [[nodiscard]] auto get_portal_ptr() const noexcept -> void *;
 
         [[nodiscard]] auto enqueue_descriptor(const dsahw_descriptor_t *desc_ptr) const noexcept -> dsahw_status_t;
 
         [[nodiscard]] auto priority() const noexcept -> int32_t;
 
+        /**
+         * @brief Returns recent load of the queue, submissions and retries that decay over a few microseconds
+         */
+        [[nodiscard]] auto load() const noexcept -> uint32_t;
+
+        /**
+         * @brief Returns number of submissions the queue rejected since its initialization
+         */
+        [[nodiscard]] auto retry_count() const noexcept -> uint64_t;
+
         [[nodiscard]] auto memory_type() const noexcept -> supported_memory_type;
 
+        [[nodiscard]] auto mode() const noexcept -> submission_mode;
+
+        /**
+         * @brief Returns number of descriptors that can be submitted to a dedicated queue without overflowing it
+         */
+        [[nodiscard]] auto credits() const noexcept -> uint32_t;
+
+        /**
+         * @brief Returns the completion record address of a descriptor, dedicated queues keep track of descriptors by it
+         */
+        [[nodiscard]] static auto completion_record_of(const dsahw_descriptor_t *desc_ptr) noexcept -> const void *;
+
+        /**
+         * @brief Submits to a dedicated queue and returns the slot its completion record is kept in until released
+         */
+        [[nodiscard]] auto enqueue_dedicated(const dsahw_descriptor_t *desc_ptr, uint32_t &slot) const noexcept -> dsahw_status_t;
+
+        /**
+         * @brief Returns the credit of a descriptor submitted to a dedicated queue once its completion record is seen written
+         *
+         * The record is only compared with the one in the slot, so it may be freed right after.
+         * Returns false if the slot holds another record.
+         */
+        auto release_credit(const void *record_ptr, uint32_t slot) const noexcept -> bool;
+
+        /**
+         * @brief Returns the credit of a record whose slot is not known, looks through the slots starting from the one it is tried first in
+         */
+        auto release_credit(const void *record_ptr) const noexcept -> bool;
+
         void set_portal_ptr(void *portal_ptr) noexcept;
 
         virtual ~hw_queue() noexcept;
 
     private:
+        void account_submission(bool retry) const noexcept;
+
+        [[nodiscard]] auto home_slot(const void *record_ptr) const noexcept -> uint32_t;
+
+        [[nodiscard]] auto take_credit(const void *record_ptr, uint32_t &slot) const noexcept -> bool;
+
         uint32_t                       version_       = 0u;
         int32_t                        priority_      = 0u;
         supported_memory_type          memory_type_   = supported_memory_type::non_durable;
         uint64_t                       portal_mask_   = 0u; /**< Mask for incrementing portals */
         mutable void                  *portal_ptr_    = nullptr;
         mutable std::atomic<uintptr_t> portal_offset_ = 0u; /**< Portal for enqcmd (mod page size)*/
+        mutable std::atomic<uint64_t>  load_state_    = 0u; /**< Time of the last submission and the load at that time */
+        mutable std::atomic<uint64_t>  retry_count_   = 0u; /**< Number of rejected submissions */
+        submission_mode                mode_          = submission_mode::shared;
+        uint32_t                       size_          = 0u; /**< Number of descriptors a dedicated queue holds */
+
+        /*
+         * Completion records of the descriptors in a dedicated queue, used as keys only. A submitter reserves
+         * a credit in the count before it takes a slot, so the count never falls behind the slots taken.
+         * A record is placed from a slot derived from its address, so records rarely compete for a slot.
+         */
+        mutable std::array<std::atomic<const void *>, max_dedicated_size> in_flight_       = {};
+        mutable std::atomic<uint32_t>                                     in_flight_count_ = 0u;
     };
 
 }  // namespace dml::core::dispatcher
@@ -0,0 +1,557 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#if defined(__linux__)
+
+#include "hw_simulator.hpp"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <core/completion_record_views.hpp>
+#include <core/descriptor_views.hpp>
+#include <core/device.hpp>
+#include <core/utils.hpp>
+#include <dml/detail/common/flags.hpp>
+#include <dml/detail/common/status.hpp>
+#include <dml/detail/common/utils/enum.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <type_traits>
+
+#include "immintrin.h"
+#include "legacy_headers/own_dsa_accel_constants.h"
+
+namespace
+{
+    using dml::core::descriptor;
+    using dml::core::operation;
+
+    // Number of empty portal scans an engine makes before it goes to sleep
+    constexpr uint32_t idle_spin_count = 256u;
+
+    // Completion times closer than this are spun for, as sleeping is not precise enough
+    constexpr uint64_t spin_wait_ns = 50000u;
+
+    // Injected faults split a transfer in two halves, so both parts are non-empty and aligned
+    constexpr uint32_t injected_fault_min_size  = 128u;
+    constexpr uint32_t injected_fault_alignment = 64u;
+
+    inline auto now_ns() noexcept -> uint64_t
+    {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    void wait_until(uint64_t time_ns) noexcept
+    {
+        auto now = now_ns();
+
+        if (time_ns > now + spin_wait_ns)
+        {
+            std::this_thread::sleep_until(std::chrono::steady_clock::time_point(std::chrono::nanoseconds(time_ns - spin_wait_ns)));
+            now = now_ns();
+        }
+
+        while (now < time_ns)
+        {
+            _mm_pause();
+            now = now_ns();
+        }
+    }
+
+    auto inject(double rate) noexcept -> bool
+    {
+        static thread_local std::minstd_rand generator(
+            static_cast<uint32_t>(std::hash<std::thread::id>()(std::this_thread::get_id())));
+
+        return rate > 0.0 && std::uniform_real_distribution<double>(0.0, 1.0)(generator) < rate;
+    }
+
+    template <typename value_t>
+    void read_variable(const char *name, value_t &value) noexcept
+    {
+        const auto *string = std::getenv(name);
+
+        if (string == nullptr)
+        {
+            return;
+        }
+
+        if constexpr (std::is_floating_point_v<value_t>)
+        {
+            value = std::max(std::strtod(string, nullptr), 0.0);
+        }
+        else
+        {
+            value = static_cast<value_t>(std::strtoull(string, nullptr, 10));
+        }
+    }
+
+    struct region
+    {
+        uint64_t address;
+        uint32_t size;
+    };
+
+    struct page_fault
+    {
+        bool     occurred = false;
+        uint32_t offset   = 0u; /**< Bytes of the transfer done before the fault */
+        uint64_t address  = 0u;
+    };
+
+    /**
+     * Returns offset of the first page of the region that is not resident, or size of the region if all of them are
+     */
+    auto first_non_resident(const region &area) noexcept -> uint32_t
+    {
+        static const auto page_size   = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+        constexpr auto    chunk_pages = 256u;
+
+        std::array<unsigned char, chunk_pages> residency{};
+
+        const auto end = area.address + area.size;
+
+        for (auto page = area.address & ~(page_size - 1u); page < end; page += chunk_pages * page_size)
+        {
+            const auto length = std::min<uint64_t>(chunk_pages * page_size, end - page);
+            const auto offset = [&](uint64_t address) { return static_cast<uint32_t>(std::max(address, area.address) - area.address); };
+
+            // Unmapped memory would fault the device as well
+            if (0 != mincore(reinterpret_cast<void *>(page), length, residency.data()))
+            {
+                return offset(page);
+            }
+
+            for (uint64_t i = 0u; i * page_size < length; ++i)
+            {
+                if (0u == (residency[i] & 1u))
+                {
+                    return offset(page + i * page_size);
+                }
+            }
+        }
+
+        return area.size;
+    }
+
+    /**
+     * Returns memory the descriptor reads or writes, only for operations the continuation can resume
+     */
+    auto touched_regions(const descriptor &dsc, std::array<region, 3u> &regions) noexcept -> size_t
+    {
+        using namespace dml::core;
+
+        auto       view = any_descriptor(dsc);
+        const auto size = view.transfer_size();
+
+        switch (static_cast<operation>(view.operation()))
+        {
+            case operation::mem_move:
+            case operation::copy_crc:
+                regions[0] = {view.source_address(), size};
+                regions[1] = {view.destination_address(), size};
+                return 2u;
+            case operation::fill:
+            case operation::cache_flush:
+                regions[0] = {view.destination_address(), size};
+                return 1u;
+            case operation::crc:
+            case operation::compare_pattern:
+                regions[0] = {view.source_address(), size};
+                return 1u;
+            case operation::compare:
+            {
+                auto compare = make_view<operation::compare>(dsc);
+                regions[0]   = {compare.source_1_address(), size};
+                regions[1]   = {compare.source_2_address(), size};
+                return 2u;
+            }
+            case operation::create_delta:
+            {
+                auto create_delta = make_view<operation::create_delta>(dsc);
+                regions[0]        = {create_delta.source_1_address(), size};
+                regions[1]        = {create_delta.source_2_address(), size};
+                regions[2]        = {create_delta.delta_record_address(), create_delta.maximum_delta_record_size()};
+                return 3u;
+            }
+            case operation::apply_delta:
+            {
+                auto apply_delta = make_view<operation::apply_delta>(dsc);
+                regions[0]       = {apply_delta.delta_record_address(), apply_delta.delta_record_size()};
+                regions[1]       = {apply_delta.destination_address(), size};
+                return 2u;
+            }
+            case operation::dualcast:
+            {
+                auto dualcast = make_view<operation::dualcast>(dsc);
+                regions[0]    = {dualcast.source_address(), size};
+                regions[1]    = {dualcast.destination_1_address(), size};
+                regions[2]    = {dualcast.destination_2_address(), size};
+                return 3u;
+            }
+            default:
+                return 0u;
+        }
+    }
+
+    /**
+     * Checks whether the first bytes of the descriptor can be done alone, so the fault reports real progress.
+     * Other operations fault with no progress and are redone from the start.
+     */
+    auto is_resumable(const descriptor &dsc) noexcept -> bool
+    {
+        auto view = dml::core::any_descriptor(dsc);
+
+        switch (static_cast<operation>(view.operation()))
+        {
+            case operation::mem_move:
+            {
+                // Overlapping moves may go backwards
+                const auto src = view.source_address();
+                const auto dst = view.destination_address();
+
+                return src + view.transfer_size() <= dst || dst + view.transfer_size() <= src;
+            }
+            case operation::fill:
+            case operation::crc:
+            case operation::copy_crc:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    auto find_page_fault(const descriptor &dsc) noexcept -> page_fault
+    {
+        auto regions = std::array<region, 3u>();
+        auto fault   = page_fault();
+
+        for (size_t i = 0u, count = touched_regions(dsc, regions); i < count; ++i)
+        {
+            const auto offset = first_non_resident(regions[i]);
+
+            if (offset < regions[i].size && (!fault.occurred || offset < fault.offset))
+            {
+                fault = {true, offset, regions[i].address + offset};
+            }
+        }
+
+        return fault;
+    }
+}  // namespace
+
+namespace dml::core::dispatcher
+{
+    auto simulation_config::from_environment() noexcept -> simulation_config
+    {
+        auto config = simulation_config();
+
+        read_variable("DML_HW_SIMULATION_DEVICES", config.devices_per_node);
+        read_variable("DML_HW_SIMULATION_QUEUES", config.queues);
+        read_variable("DML_HW_SIMULATION_QUEUE_SIZE", config.queue_size);
+        read_variable("DML_HW_SIMULATION_ENGINES", config.engines);
+        read_variable("DML_HW_SIMULATION_LATENCY_NS", config.latency_ns);
+        read_variable("DML_HW_SIMULATION_BANDWIDTH", config.bandwidth);
+        read_variable("DML_HW_SIMULATION_RETRY_RATE", config.retry_rate);
+        read_variable("DML_HW_SIMULATION_PAGE_FAULT_RATE", config.page_fault_rate);
+
+        config.devices_per_node = std::clamp(config.devices_per_node, 1u, static_cast<uint32_t>(MAX_DEVICE_COUNT));
+        config.queues           = std::clamp(config.queues, 1u, static_cast<uint32_t>(MAX_WORK_QUEUE_COUNT));
+        config.queue_size       = std::max(config.queue_size, 1u);
+        config.engines          = std::max(config.engines, 1u);
+
+        return config;
+    }
+
+    auto is_simulation_enabled() noexcept -> bool
+    {
+        const auto *value = std::getenv("DML_HW_SIMULATION");
+
+        if (value == nullptr)
+        {
+#if defined(DML_HW_SIMULATION)
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        return std::strtol(value, nullptr, 10) != 0;
+    }
+
+    static auto ring_capacity(uint32_t size) noexcept -> size_t
+    {
+        size_t capacity = 1u;
+
+        while (capacity < size)
+        {
+            capacity <<= 1u;
+        }
+
+        return capacity;
+    }
+
+    simulated_portal::simulated_portal(simulated_device &device, uint32_t size) noexcept
+        : device_(device),
+          size_(size),
+          ring_(ring_capacity(size))
+    {
+    }
+
+    auto simulated_portal::submit(const void *desc_ptr) noexcept -> bool
+    {
+        if (inject(device_.config_.retry_rate))
+        {
+            return false;
+        }
+
+        if (occupancy_.fetch_add(1u) >= size_)
+        {
+            occupancy_.fetch_sub(1u);
+            return false;
+        }
+
+        auto work = entry();
+        std::memcpy(&work.dsc, desc_ptr, sizeof(work.dsc));
+        work.submit_time = now_ns();
+
+        // Ring is larger than the queue, so a reserved place is always there
+        static_cast<void>(ring_.try_push(work));
+
+        device_.notify();
+
+        return true;
+    }
+
+    auto simulated_portal::size() const noexcept -> uint32_t
+    {
+        return size_;
+    }
+
+    simulated_device::simulated_device(const simulation_config &config, uint64_t numa_id) noexcept
+        : config_(config),
+          numa_id_(numa_id)
+    {
+        for (uint32_t i = 0u; i < config_.queues; ++i)
+        {
+            portals_.push_back(std::make_unique<simulated_portal>(*this, config_.queue_size));
+        }
+
+        for (uint32_t i = 0u; i < config_.engines; ++i)
+        {
+            engines_.emplace_back(&simulated_device::process, this, i);
+        }
+    }
+
+    simulated_device::~simulated_device() noexcept
+    {
+        stop_requested_.store(true);
+
+        {
+            std::lock_guard<std::mutex> lock(guard_);
+        }
+        wakeup_.notify_all();
+
+        for (auto &engine : engines_)
+        {
+            if (engine.joinable())
+            {
+                engine.join();
+            }
+        }
+    }
+
+    auto simulated_device::numa_id() const noexcept -> uint64_t
+    {
+        return numa_id_;
+    }
+
+    auto simulated_device::portal_count() const noexcept -> size_t
+    {
+        return portals_.size();
+    }
+
+    auto simulated_device::portal(size_t idx) noexcept -> simulated_portal &
+    {
+        return *portals_[idx];
+    }
+
+    void simulated_device::notify() noexcept
+    {
+        // Pairs with the sleeping counter increment in process(), see sw_engine::enqueue()
+        if (sleeping_.load() != 0u)
+        {
+            {
+                std::lock_guard<std::mutex> lock(guard_);
+            }
+            wakeup_.notify_one();
+        }
+    }
+
+    auto simulated_device::has_work() const noexcept -> bool
+    {
+        return std::any_of(portals_.begin(), portals_.end(), [](const auto &portal) { return !portal->ring_.empty(); });
+    }
+
+    auto simulated_device::reserve_bandwidth(uint64_t arrival_time, uint64_t size) noexcept -> uint64_t
+    {
+        if (config_.bandwidth <= 0.0)
+        {
+            return arrival_time;
+        }
+
+        // GB/s is the same as bytes per nanosecond
+        const auto busy_time = static_cast<uint64_t>(static_cast<double>(size) / config_.bandwidth);
+
+        auto free_time = link_free_time_.load();
+        auto done_time = uint64_t(0u);
+
+        do
+        {
+            done_time = std::max(arrival_time, free_time) + busy_time;
+        } while (!link_free_time_.compare_exchange_weak(free_time, done_time));
+
+        return done_time;
+    }
+
+    void simulated_device::process(uint32_t engine_idx) noexcept
+    {
+        auto work       = simulated_portal::entry();
+        auto next       = static_cast<size_t>(engine_idx);
+        auto idle_spins = 0u;
+
+        while (true)
+        {
+            auto found = false;
+
+            // Portals are served in turn, starting from the one after the last served
+            for (size_t i = 0u; i < portals_.size() && !found; ++i)
+            {
+                auto &portal = *portals_[(next + i) % portals_.size()];
+
+                if (portal.ring_.try_pop(work))
+                {
+                    portal.occupancy_.fetch_sub(1u);
+
+                    next  = (next + i + 1u) % portals_.size();
+                    found = true;
+                }
+            }
+
+            if (found)
+            {
+                idle_spins = 0u;
+                complete(work);
+                continue;
+            }
+
+            if (stop_requested_.load())
+            {
+                return;
+            }
+
+            if (++idle_spins < idle_spin_count)
+            {
+                _mm_pause();
+                continue;
+            }
+
+            idle_spins = 0u;
+
+            std::unique_lock<std::mutex> lock(guard_);
+            sleeping_.fetch_add(1u);
+            wakeup_.wait(lock, [&]() { return has_work() || stop_requested_.load(); });
+            sleeping_.fetch_sub(1u);
+        }
+    }
+
+    void simulated_device::complete(const simulated_portal::entry &work) noexcept
+    {
+        using dml::detail::execution_status;
+
+        // The copy writes its record locally, the real one is written when the descriptor is due
+        auto dsc    = work.dsc;
+        auto view   = any_descriptor(dsc);
+        auto result = completion_record();
+
+        const auto record_address        = view.completion_record_address();
+        view.completion_record_address() = reinterpret_cast<address_t>(&result);
+
+        const auto op             = static_cast<operation>(view.operation());
+        const auto is_control     = (operation::nop == op || operation::batch == op || operation::drain == op);
+        const auto transfer_size  = is_control ? 0u : view.transfer_size();
+        const auto block_on_fault = 0u != (view.flags() & to_underlying(dml::detail::flag::block_on_fault));
+        auto       fault          = page_fault();
+
+        if (!block_on_fault)
+        {
+            fault = find_page_fault(dsc);
+
+            if (!fault.occurred && is_resumable(dsc) && transfer_size >= injected_fault_min_size && inject(config_.page_fault_rate))
+            {
+                const auto offset  = (transfer_size / 2u) & ~(injected_fault_alignment - 1u);
+                const auto address = (operation::fill == op) ? view.destination_address() : view.source_address();
+
+                fault = {true, offset, address + offset};
+            }
+        }
+
+        if (block_on_fault && is_control)
+        {
+            // The flag is reserved for operations that do not access memory themselves
+            any_completion_record(result).status() = to_underlying(execution_status::flag_error);
+        }
+        else if (fault.occurred)
+        {
+            if (is_resumable(dsc))
+            {
+                view.transfer_size() = fault.offset;
+                static_cast<void>(software_device().execute(dsc));
+            }
+            else
+            {
+                fault.offset = 0u;
+            }
+
+            auto record              = any_completion_record(result);
+            record.status()          = to_underlying(execution_status::page_fault_during_processing);
+            record.bytes_completed() = fault.offset;
+            record.fault_address()   = fault.address;
+        }
+        else if (software_device().execute(dsc) != dml::detail::submission_status::success)
+        {
+            any_completion_record(result).status() = to_underlying(execution_status::operation_error);
+        }
+
+        wait_until(reserve_bandwidth(work.submit_time + config_.latency_ns, transfer_size));
+
+        if (0u == record_address)
+        {
+            return;
+        }
+
+        // Status goes last, as waiters poll for it
+        auto *bytes = reinterpret_cast<volatile uint8_t *>(record_address);
+
+        for (size_t i = 1u; i < sizeof(result.bytes); ++i)
+        {
+            bytes[i] = result.bytes[i];
+        }
+
+        std::atomic_thread_fence(std::memory_order_release);
+        bytes[0] = result.bytes[0];
+    }
+}  // namespace dml::core::dispatcher
+
+#endif
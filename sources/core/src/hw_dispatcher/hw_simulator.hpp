@@ -0,0 +1,151 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef DML_MIDDLE_LAYER_DISPATCHER_HW_SIMULATOR_HPP_
+#define DML_MIDDLE_LAYER_DISPATCHER_HW_SIMULATOR_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <core/types.hpp>
+
+#include "../sw_engine/submission_ring.hpp"
+
+#if defined(__linux__)
+
+namespace dml::core::dispatcher
+{
+    /**
+     * @brief Parameters of simulated devices
+     *
+     * Every field can be overridden with an environment variable, see @ref from_environment.
+     */
+    struct simulation_config
+    {
+        uint32_t devices_per_node = 1u;    /**< DML_HW_SIMULATION_DEVICES, devices on every NUMA node */
+        uint32_t queues           = 2u;    /**< DML_HW_SIMULATION_QUEUES, work queues of a device */
+        uint32_t queue_size       = 32u;   /**< DML_HW_SIMULATION_QUEUE_SIZE, descriptors a work queue holds */
+        uint32_t engines          = 4u;    /**< DML_HW_SIMULATION_ENGINES, engines (threads) of a device */
+        uint64_t latency_ns       = 1000u; /**< DML_HW_SIMULATION_LATENCY_NS, time from submission to completion */
+        double   bandwidth        = 30.0;  /**< DML_HW_SIMULATION_BANDWIDTH, GB/s shared by the engines, 0 is unlimited */
+        double   retry_rate       = 0.0;   /**< DML_HW_SIMULATION_RETRY_RATE, share of submissions rejected at random */
+        double   page_fault_rate  = 0.0;   /**< DML_HW_SIMULATION_PAGE_FAULT_RATE, share of descriptors faulted at random */
+
+        /**
+         * @brief Returns default parameters updated with the environment variables that are set
+         */
+        static auto from_environment() noexcept -> simulation_config;
+    };
+
+    /**
+     * @brief Checks whether the hardware path runs on simulated devices
+     *
+     * Enabled by DML_HW_SIMULATION=1 or by building with the DML_HW_SIMULATION option,
+     * in which case DML_HW_SIMULATION=0 turns the simulation off.
+     */
+    [[nodiscard]] auto is_simulation_enabled() noexcept -> bool;
+
+    class simulated_device;
+
+    /**
+     * @brief Virtual portal of a simulated shared work queue
+     *
+     * Descriptors are copied into a ring the engines of the device take them from.
+     * A submission is rejected when the queue holds its size of descriptors, the same way ENQCMD fails.
+     */
+    class simulated_portal final
+    {
+        friend class simulated_device;
+
+        struct entry
+        {
+            descriptor dsc;             /**< Copy of the submitted descriptor */
+            uint64_t   submit_time = 0; /**< Submission time in nanoseconds */
+        };
+
+    public:
+        simulated_portal(simulated_device &device, uint32_t size) noexcept;
+
+        simulated_portal(const simulated_portal &) = delete;
+
+        auto operator=(const simulated_portal &) -> simulated_portal & = delete;
+
+        /**
+         * @brief Submits a 64-byte descriptor
+         *
+         * @return false if the queue is full or a retry is injected
+         */
+        [[nodiscard]] auto submit(const void *desc_ptr) noexcept -> bool;
+
+        [[nodiscard]] auto size() const noexcept -> uint32_t;
+
+    private:
+        simulated_device              &device_;
+        const uint32_t                 size_;
+        engine::submission_ring<entry> ring_;
+        std::atomic<uint32_t>          occupancy_{0u}; /**< Descriptors that are not taken by engines yet */
+    };
+
+    /**
+     * @brief Device that executes descriptors with the software kernels
+     *
+     * Engine threads take descriptors from the portals in turn. A descriptor completes no sooner than
+     * the configured latency after its submission and takes its share of the device bandwidth.
+     * Its completion record is written when that time comes, so waiters see hardware-like timing.
+     *
+     * Without the block on fault flag, a descriptor that touches a page which is not resident
+     * completes partially with a page fault, as on a device without a resident IOMMU mapping.
+     */
+    class simulated_device final
+    {
+        friend class simulated_portal;
+
+    public:
+        simulated_device(const simulation_config &config, uint64_t numa_id) noexcept;
+
+        simulated_device(const simulated_device &) = delete;
+
+        auto operator=(const simulated_device &) -> simulated_device & = delete;
+
+        ~simulated_device() noexcept;
+
+        [[nodiscard]] auto numa_id() const noexcept -> uint64_t;
+
+        [[nodiscard]] auto portal_count() const noexcept -> size_t;
+
+        [[nodiscard]] auto portal(size_t idx) noexcept -> simulated_portal &;
+
+    private:
+        void process(uint32_t engine_idx) noexcept;
+
+        void complete(const simulated_portal::entry &work) noexcept;
+
+        void notify() noexcept;
+
+        [[nodiscard]] auto has_work() const noexcept -> bool;
+
+        [[nodiscard]] auto reserve_bandwidth(uint64_t arrival_time, uint64_t size) noexcept -> uint64_t;
+
+        const simulation_config                        config_;
+        const uint64_t                                 numa_id_;
+        std::vector<std::unique_ptr<simulated_portal>> portals_;
+        std::vector<std::thread>                       engines_;
+        std::mutex                                     guard_;
+        std::condition_variable                        wakeup_;
+        std::atomic<uint32_t>                          sleeping_{0u};
+        std::atomic<uint64_t>                          link_free_time_{0u}; /**< Time the bandwidth is free at */
+        std::atomic<bool>                              stop_requested_{false};
+    };
+
+}  // namespace dml::core::dispatcher
+
+#endif
+#endif  //DML_MIDDLE_LAYER_DISPATCHER_HW_SIMULATOR_HPP_
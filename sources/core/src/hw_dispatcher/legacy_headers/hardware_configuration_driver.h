@@ -99,6 +99,8 @@ int DML_HW_API(group_get_id)(struct accfg_group *group);
 
 int DML_HW_API(work_queue_get_device_path)(struct accfg_wq *wq, char *buf, size_t size);
 
+int DML_HW_API(work_queue_get_size)(struct accfg_wq *wq);
+
 #ifdef __cplusplus
 }
 #endif
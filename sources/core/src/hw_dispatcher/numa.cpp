@@ -5,9 +5,16 @@
  ******************************************************************************/
 
 #if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
 #include <x86intrin.h>
 #endif
 
+#include <array>
+#include <fstream>
+#include <core/descriptor_views.hpp>
+#include <core/operations.hpp>
+
 #include "numa.hpp"
 
 namespace dml::core::util
@@ -27,4 +34,126 @@ namespace dml::core::util
 #endif
     }
 
+    std::vector<std::string> read_numa_node_files(const char *name) noexcept
+    {
+        std::vector<std::string> lines;
+
+#if defined(__linux__)
+        // Node ids are dense for almost all systems, the first gap ends enumeration
+        for (uint32_t id = 0u;; ++id)
+        {
+            std::ifstream file("/sys/devices/system/node/node" + std::to_string(id) + "/" + name);
+            if (!file.is_open())
+            {
+                break;
+            }
+
+            std::getline(file, lines.emplace_back());
+        }
+#else
+        static_cast<void>(name);
+#endif
+
+        return lines;
+    }
+
+#if defined(__linux__)
+    static uint32_t query_memory_numa_id(const void *address) noexcept
+    {
+        auto *page   = const_cast<void *>(address);
+        int   status = -1;
+
+        // No target nodes turns move_pages into a query that neither moves nor faults pages in
+        if (0 != syscall(SYS_move_pages, 0, 1ul, &page, nullptr, &status, 0) || status < 0)
+        {
+            return current_numa_id;
+        }
+
+        return static_cast<uint32_t>(status);
+    }
+#endif
+
+    uint32_t get_memory_numa_id(const void *address) noexcept
+    {
+#if defined(__linux__)
+        struct region
+        {
+            uint64_t id      = std::numeric_limits<uint64_t>::max();
+            uint32_t numa_id = current_numa_id;
+            uint32_t hits    = 0u; /**< Lookups left before the node is queried again */
+        };
+
+        constexpr uint32_t region_shift = 21u;
+        constexpr uint32_t region_hits  = 1024u;
+
+        // Memory that is not resident yet usually is soon after, the node is queried again after a few lookups
+        constexpr uint32_t unknown_region_hits = 16u;
+
+        static thread_local std::array<region, 64u> regions{};
+
+        const auto id    = reinterpret_cast<uint64_t>(address) >> region_shift;
+        auto      &entry = regions[id % regions.size()];
+
+        if (entry.id != id || entry.hits == 0u)
+        {
+            entry.id      = id;
+            entry.numa_id = query_memory_numa_id(address);
+            entry.hits    = (entry.numa_id == current_numa_id) ? unknown_region_hits : region_hits;
+        }
+
+        --entry.hits;
+
+        return entry.numa_id;
+#else
+        static_cast<void>(address);
+
+        return current_numa_id;
+#endif
+    }
+
+    static const void *get_data_address(const descriptor &dsc) noexcept
+    {
+        auto view = any_descriptor(dsc);
+
+        switch (static_cast<operation>(view.operation()))
+        {
+            case operation::nop:
+            case operation::drain:
+                return nullptr;
+            case operation::batch:
+            {
+                const auto *first = reinterpret_cast<const descriptor *>(view.source_address());
+
+                // Batches can't be nested, so the recursion ends here
+                if (first == nullptr || any_descriptor(*first).operation() == static_cast<operation_t>(operation::batch))
+                {
+                    return nullptr;
+                }
+
+                return get_data_address(*first);
+            }
+            // The destination field holds either nothing or another source for these operations
+            case operation::compare:
+            case operation::compare_pattern:
+            case operation::create_delta:
+            case operation::crc:
+            case operation::dif_check:
+                return reinterpret_cast<const void *>(view.source_address());
+            default:
+                return reinterpret_cast<const void *>(view.destination_address());
+        }
+    }
+
+    uint32_t resolve_numa_id(const descriptor &dsc, uint32_t numa_id) noexcept
+    {
+        if (data_numa_id == numa_id)
+        {
+            const auto *address = get_data_address(dsc);
+
+            numa_id = (address != nullptr) ? get_memory_numa_id(address) : current_numa_id;
+        }
+
+        return (current_numa_id == numa_id) ? get_numa_id() : numa_id;
+    }
+
 }  // namespace dml::core::util
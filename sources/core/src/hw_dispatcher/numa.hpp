@@ -8,10 +8,50 @@
 #define DML_MIDDLE_LAYER_DISPATCHER_NUMA_HPP_
 
 #include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <core/types.hpp>
 
 namespace dml::core::util
 {
+    /**
+     * @brief NUMA id that selects the node of the submitting thread
+     */
+    constexpr uint32_t current_numa_id = std::numeric_limits<uint32_t>::max();
+
+    /**
+     * @brief NUMA id that selects the node of the memory a descriptor works with, see @ref resolve_numa_id
+     */
+    constexpr uint32_t data_numa_id = std::numeric_limits<uint32_t>::max() - 1u;
+
     [[nodiscard]] uint32_t get_numa_id() noexcept;
+
+    /**
+     * @brief Returns the first line of a sysfs file of every NUMA node, e.g. "cpulist" or "distance", indexed by node id
+     *
+     * Empty if the system does not describe its nodes.
+     */
+    [[nodiscard]] std::vector<std::string> read_numa_node_files(const char *name) noexcept;
+
+    /**
+     * @brief Returns the node of the memory page at the address or @ref current_numa_id if it is unknown
+     *
+     * A page that is not resident yet has no node. Results are cached per thread for 2 MB regions
+     * and refreshed after a number of lookups, so pages that migrate are eventually followed.
+     * Unknown nodes are refreshed much sooner, so memory is placed soon after it is first written.
+     */
+    [[nodiscard]] uint32_t get_memory_numa_id(const void *address) noexcept;
+
+    /**
+     * @brief Turns the special NUMA ids into the node a descriptor is submitted to
+     *
+     * For @ref data_numa_id it is the node of the destination, or of the source for operations
+     * that only read memory. The first descriptor of a batch is looked at.
+     * Descriptors without data and memory of unknown node fall back to the node of the submitting thread.
+     */
+    [[nodiscard]] uint32_t resolve_numa_id(const descriptor &dsc, uint32_t numa_id) noexcept;
 }
 
 #endif  //DML_MIDDLE_LAYER_DISPATCHER_NUMA_HPP_
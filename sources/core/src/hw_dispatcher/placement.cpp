@@ -0,0 +1,144 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "placement.hpp"
+
+#include "numa.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <utility>
+
+namespace dml::core::dispatcher
+{
+    // Distance to an unknown remote node, the one the kernel reports for a neighbor socket
+    static constexpr uint32_t unknown_remote_distance = 20u;
+
+    static auto read_distances() noexcept -> std::vector<std::vector<uint32_t>>
+    {
+        std::vector<std::vector<uint32_t>> distances;
+
+        for (const auto &line : util::read_numa_node_files("distance"))
+        {
+            auto &row    = distances.emplace_back();
+            auto  stream = std::istringstream(line);
+
+            for (uint32_t value = 0u; stream >> value;)
+            {
+                row.push_back(value);
+            }
+        }
+
+        return distances;
+    }
+
+    placement::placement(policy placement_policy, uint32_t spill_retries, std::vector<std::vector<uint32_t>> distances) noexcept
+        : policy_(placement_policy),
+          spill_retries_(std::max(spill_retries, 1u)),
+          distances_(std::move(distances))
+    {
+    }
+
+    auto placement::from_environment() noexcept -> placement
+    {
+        auto placement_policy = policy::local;
+        auto spill_retries    = 1u;
+
+        if (const auto *value = std::getenv("DML_HW_PLACEMENT"); value != nullptr)
+        {
+            if (0 == std::strcmp(value, "spill"))
+            {
+                placement_policy = policy::spill;
+            }
+            else if (0 == std::strcmp(value, "weighted"))
+            {
+                placement_policy = policy::weighted;
+            }
+        }
+
+        if (const auto *value = std::getenv("DML_HW_SPILL_RETRIES"); value != nullptr)
+        {
+            const auto retries = std::strtol(value, nullptr, 10);
+
+            spill_retries = retries > 0 ? static_cast<uint32_t>(retries) : 1u;
+        }
+
+        return placement(placement_policy, spill_retries, read_distances());
+    }
+
+    auto placement::get_policy() const noexcept -> policy
+    {
+        return policy_;
+    }
+
+    auto placement::spill_retries() const noexcept -> uint32_t
+    {
+        return spill_retries_;
+    }
+
+    auto placement::distance(uint64_t from, uint64_t to) const noexcept -> uint32_t
+    {
+        if (from < distances_.size() && to < distances_[from].size())
+        {
+            return distances_[from][to];
+        }
+
+        return (from == to) ? local_distance : unknown_remote_distance;
+    }
+
+    auto placement::order(uint64_t numa_id, const device_state *devices, size_t count, size_t first, uint32_t *order) const noexcept
+        -> size_t
+    {
+        // Smaller keys go first: locality for the local and spill policies, then load
+        const auto key = [&](const device_state &device) -> std::pair<uint32_t, uint32_t>
+        {
+            const auto device_distance = distance(numa_id, device.numa_id);
+
+            switch (policy_)
+            {
+                case policy::weighted:
+                    return {0u, device.load + (std::max(device_distance, local_distance) - local_distance) * distance_load};
+                case policy::spill:
+                    return {(device.numa_id == numa_id) ? 0u : device_distance, device.load};
+                default:
+                    return {0u, device.load};
+            }
+        };
+
+        size_t size = 0u;
+
+        for (size_t i = 0u; i < count; ++i)
+        {
+            const auto idx = static_cast<uint32_t>((first + i) % count);
+
+            if (policy::local == policy_ && devices[idx].numa_id != numa_id)
+            {
+                continue;
+            }
+
+            order[size++] = idx;
+        }
+
+        // Insertion sort is stable and there are a few devices only
+        for (size_t i = 1u; i < size; ++i)
+        {
+            const auto idx = order[i];
+            auto       j   = i;
+
+            for (; j > 0u && key(devices[idx]) < key(devices[order[j - 1u]]); --j)
+            {
+                order[j] = order[j - 1u];
+            }
+
+            order[j] = idx;
+        }
+
+        return size;
+    }
+}  // namespace dml::core::dispatcher
@@ -0,0 +1,100 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef DML_MIDDLE_LAYER_DISPATCHER_PLACEMENT_HPP_
+#define DML_MIDDLE_LAYER_DISPATCHER_PLACEMENT_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace dml::core::dispatcher
+{
+    /**
+     * @brief Decides which devices a descriptor is submitted to, depending on their NUMA nodes
+     *
+     * The policy is read from the DML_HW_PLACEMENT environment variable:
+     * - local    - only devices on the node of the submitter are used (default)
+     * - spill    - devices on the node are tried DML_HW_SPILL_RETRIES times (1 by default),
+     *              then remote devices from the nearest node to the farthest one
+     * - weighted - all devices are tried in order of their load plus a penalty for distance
+     *
+     * Node distances are taken from /sys/devices/system/node/node<N>/distance.
+     */
+    class placement final
+    {
+    public:
+        enum class policy
+        {
+            local,
+            spill,
+            weighted
+        };
+
+        /**
+         * @brief State of a device the order is built for
+         */
+        struct device_state
+        {
+            uint64_t numa_id; /**< NUMA node of the device */
+            uint32_t load;    /**< Load of the device, see @ref hw_device::load */
+        };
+
+        /**
+         * @brief Distance of a node to itself, as reported by the kernel
+         */
+        static constexpr uint32_t local_distance = 10u;
+
+        /**
+         * @brief Load a unit of distance is worth for the weighted policy, that is one recent submission
+         */
+        static constexpr uint32_t distance_load = 16u;
+
+        placement() noexcept = default;
+
+        /**
+         * @param placement_policy Policy to follow
+         * @param spill_retries    Number of times local devices are tried before remote ones by the spill policy
+         * @param distances        Distances between nodes, row per node, distances to the unknown nodes are guessed
+         */
+        placement(policy placement_policy, uint32_t spill_retries, std::vector<std::vector<uint32_t>> distances) noexcept;
+
+        /**
+         * @brief Creates placement from the environment variables and the distances in sysfs
+         */
+        static auto from_environment() noexcept -> placement;
+
+        [[nodiscard]] auto get_policy() const noexcept -> policy;
+
+        [[nodiscard]] auto spill_retries() const noexcept -> uint32_t;
+
+        [[nodiscard]] auto distance(uint64_t from, uint64_t to) const noexcept -> uint32_t;
+
+        /**
+         * @brief Orders devices for submission from a node
+         *
+         * Local devices are ordered by load. Devices with equal keys keep their order starting from
+         * the first index, so submitters with different first indexes spread over them.
+         *
+         * @param numa_id      Node of the submitter
+         * @param devices      States of the devices
+         * @param count        Number of devices
+         * @param first        Index of the device the order starts from for equal keys
+         * @param order        Indexes of the devices in order they should be tried, at least count entries
+         *
+         * @return Number of devices to try, local devices go first for the local and spill policies
+         */
+        auto order(uint64_t numa_id, const device_state *devices, size_t count, size_t first, uint32_t *order) const noexcept
+            -> size_t;
+
+    private:
+        policy                             policy_        = policy::local;
+        uint32_t                           spill_retries_ = 1u;
+        std::vector<std::vector<uint32_t>> distances_;
+    };
+}  // namespace dml::core::dispatcher
+
+#endif  //DML_MIDDLE_LAYER_DISPATCHER_PLACEMENT_HPP_
@@ -33,6 +33,11 @@ namespace dml::core::kernels
 
     void crc(const_view<descriptor, operation::crc> dsc) noexcept;
 
+    /**
+     * @brief Executes CRC descriptors of a batch together, so the software path can hash several buffers at once
+     */
+    void crc_multi(const descriptor *descriptors, size_t count) noexcept;
+
     void copy_crc(const_view<descriptor, operation::copy_crc> dsc) noexcept;
 
     void dif_check(const_view<descriptor, operation::dif_check> dsc) noexcept;
@@ -5,12 +5,14 @@
  ******************************************************************************/
 
 #include <core/utils.hpp>
+#include <dml/detail/common/flags.hpp>
 #include <dml/detail/common/status.hpp>
 #include <dml/detail/common/utils/enum.hpp>
 #include <optimization_dispatcher.hpp>
 
 #include "immintrin.h"
 #include "kernels.hpp"
+#include "sw_engine/parallel_pool.hpp"
 
 namespace dml::core::kernels
 {
@@ -22,7 +24,23 @@ namespace dml::core::kernels
         const auto dst           = reinterpret_cast<byte_t *>(dsc.destination_address());
         const auto transfer_size = dsc.transfer_size();
 
-        dispatch::mem_move(src, dst, transfer_size);
+        const auto overlapping = (src < dst + transfer_size) && (dst < src + transfer_size);
+
+        if (overlapping)
+        {
+            // Copy direction matters for overlapping buffers, so they are never split
+            dispatch::mem_move(src, dst, transfer_size);
+        }
+        else
+        {
+            const auto cache_control = intersects(dsc.flags(), dml::detail::mem_move_flag::cache_control);
+            const auto copy          = dispatch::is_non_temporal(transfer_size, cache_control) ? dispatch::mem_move_non_temporal : dispatch::mem_move;
+            const auto chunks        = engine::parallel_pool::get_instance().split(transfer_size, engine::page_size);
+
+            engine::parallel_for(chunks,
+                                 [src, dst, copy](std::uint32_t, std::uint32_t offset, std::uint32_t size)
+                                 { copy(src + offset, dst + offset, size); });
+        }
 
         _mm_mfence();
         record.status() = to_underlying(dml::detail::execution_status::success);
@@ -7,14 +7,49 @@
 #include <core/completion_record_views.hpp>
 #include <core/descriptor_views.hpp>
 #include <core/operations.hpp>
+#include <core/utils.hpp>
 #include <dml/detail/common/status.hpp>
+#include <optimization_dispatcher.hpp>
 
 #include "core/device.hpp"
 #include "kernels.hpp"
+#include "sw_engine/sw_engine.hpp"
 
 namespace dml::core
 {
-    dml::detail::submission_status software_device::submit(const descriptor& dsc) noexcept
+    dml::detail::submission_status software_device::submit(const descriptor& dsc, std::uint32_t numa_id) noexcept
+    {
+        auto& engine = engine::sw_engine::get_instance();
+
+        if (!engine.is_enabled())
+        {
+            return execute(dsc);
+        }
+
+        // Write 0 to completion record before submit, as it is done for hardware
+        auto& record = get_completion_record(dsc);
+        for (auto& byte : record.bytes)
+        {
+            byte = 0u;
+        }
+
+        if (engine.enqueue(dsc, numa_id) != dml::detail::submission_status::success)
+        {
+            // Submission ring is full, run the descriptor in place rather than fail
+            return execute(dsc);
+        }
+
+        return dml::detail::submission_status::success;
+    }
+
+    dispatch::wait_estimate& software_device::wait_estimate() noexcept
+    {
+        static auto estimate = dispatch::wait_estimate();
+
+        return estimate;
+    }
+
+    dml::detail::submission_status software_device::execute(const descriptor& dsc) noexcept
     {
         auto  view   = any_descriptor(dsc);
         auto  op     = operation(view.operation());
@@ -0,0 +1,49 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "../dml_kernels.h"
+
+#if defined(_MSC_BUILD)
+#include <intrin.h>
+#elif defined(__GNUC__)
+#include <x86intrin.h>
+#else
+#error "Unsupported compiler"
+#endif
+
+uint32_t dml_avx2_compare(const uint8_t *src1, const uint8_t *src2, uint32_t transfer_size, uint8_t *result)
+{
+    const uint8_t equal     = 0x0;
+    const uint8_t not_equal = 0x1;
+
+    uint32_t i = 0u;
+
+    for (; (i + 32u) <= transfer_size; i += 32u)
+    {
+        const __m256i ymm1 = _mm256_loadu_si256((const __m256i *)(src1 + i));
+        const __m256i ymm2 = _mm256_loadu_si256((const __m256i *)(src2 + i));
+
+        const uint32_t mismatch_mask = ~(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(ymm1, ymm2));
+
+        if (mismatch_mask)
+        {
+            *result = not_equal;
+            return i + _tzcnt_u32(mismatch_mask);
+        }
+    }
+
+    for (; i < transfer_size; ++i)
+    {
+        if (src1[i] != src2[i])
+        {
+            *result = not_equal;
+            return i;
+        }
+    }
+
+    *result = equal;
+    return 0;
+}
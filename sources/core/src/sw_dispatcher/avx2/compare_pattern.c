@@ -0,0 +1,65 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "../dml_kernels.h"
+
+#if defined(_MSC_BUILD)
+#include <intrin.h>
+#elif defined(__GNUC__)
+#include <x86intrin.h>
+#else
+#error "Unsupported compiler"
+#endif
+
+uint32_t dml_avx2_compare_pattern(uint64_t pattern, const uint8_t *src, uint32_t transfer_size, uint8_t *result)
+{
+    const uint8_t equal     = 0x0;
+    const uint8_t not_equal = 0x1;
+
+    const uint32_t pattern_chunk_count = transfer_size >> 3u;
+    const uint32_t tail_bytes_count    = transfer_size & 7u;
+
+    const __m256i ymm_pattern = _mm256_set1_epi64x((long long)pattern);
+
+    uint32_t i = 0u;
+
+    // Mismatch is reported at the start of the first 8-byte chunk that differs
+    for (; (i + 4u) <= pattern_chunk_count; i += 4u)
+    {
+        const __m256i  ymm_data      = _mm256_loadu_si256((const __m256i *)(src + (i << 3u)));
+        const uint32_t mismatch_mask = ~(uint32_t)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(ymm_data, ymm_pattern))) & 0xFu;
+
+        if (mismatch_mask)
+        {
+            *result = not_equal;
+            return (i + _tzcnt_u32(mismatch_mask)) << 3u;
+        }
+    }
+
+    for (; i < pattern_chunk_count; ++i)
+    {
+        if (*(const uint64_t *)(src + (i << 3u)) != pattern)
+        {
+            *result = not_equal;
+            return i << 3u;
+        }
+    }
+
+    const uint8_t *const tail       = src + (pattern_chunk_count << 3u);
+    const uint8_t *const pattern_u8 = (const uint8_t *)&pattern;
+
+    for (i = 0u; i < tail_bytes_count; ++i)
+    {
+        if (tail[i] != pattern_u8[i])
+        {
+            *result = not_equal;
+            return (pattern_chunk_count << 3u) + i;
+        }
+    }
+
+    *result = equal;
+    return 0;
+}
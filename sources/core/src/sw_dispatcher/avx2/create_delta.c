@@ -0,0 +1,83 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "../dml_kernels.h"
+
+#if defined(_MSC_BUILD)
+#include <intrin.h>
+#elif defined(__GNUC__)
+#include <x86intrin.h>
+#else
+#error "Unsupported compiler"
+#endif
+
+uint32_t dml_avx2_create_delta(const uint8_t *src1,
+                               const uint8_t *src2,
+                               uint32_t       transfer_size,
+                               uint8_t       *delta_record,
+                               uint32_t       delta_record_max_size,
+                               uint8_t       *result)
+{
+    typedef uint64_t block_t;
+    typedef uint16_t offset_t;
+
+    const uint32_t delta_note_size = sizeof(block_t) + sizeof(offset_t);
+    const uint32_t block_count     = transfer_size / sizeof(block_t);
+    const uint8_t  overflow        = 0x2;
+
+    uint32_t delta_record_size = 0u;
+    uint32_t index             = 0u;
+
+    // Four blocks are compared at once, the notes are written for differing blocks only
+    for (; index < block_count; index += 4u)
+    {
+        uint32_t mismatch_mask = 0u;
+
+        if ((index + 4u) <= block_count)
+        {
+            const __m256i ymm1 = _mm256_loadu_si256((const __m256i *)(src1 + index * sizeof(block_t)));
+            const __m256i ymm2 = _mm256_loadu_si256((const __m256i *)(src2 + index * sizeof(block_t)));
+
+            mismatch_mask = ~(uint32_t)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(ymm1, ymm2))) & 0xFu;
+        }
+        else
+        {
+            for (uint32_t i = 0u; (index + i) < block_count; ++i)
+            {
+                const block_t block1 = *(((const block_t *)src1) + index + i);
+                const block_t block2 = *(((const block_t *)src2) + index + i);
+
+                mismatch_mask |= (block1 != block2) ? (1u << i) : 0u;
+            }
+        }
+
+        while (mismatch_mask)
+        {
+            const uint32_t block = index + _tzcnt_u32(mismatch_mask);
+
+            if ((delta_record_size + delta_note_size) > delta_record_max_size)
+            {
+                *result = overflow;
+                return delta_record_size;
+            }
+
+            uint8_t *const delta_position = delta_record + delta_record_size;
+
+            *(offset_t *)delta_position                    = (offset_t)block;
+            *(block_t *)(delta_position + sizeof(offset_t)) = *(((const block_t *)src2) + block);
+
+            delta_record_size += delta_note_size;
+            mismatch_mask &= mismatch_mask - 1u;
+        }
+    }
+
+    const uint8_t equal     = 0x0;
+    const uint8_t not_equal = 0x1;
+
+    *result = delta_record_size ? not_equal : equal;
+
+    return delta_record_size;
+}
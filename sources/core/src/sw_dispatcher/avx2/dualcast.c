@@ -0,0 +1,43 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "../dml_kernels.h"
+
+#if defined(_MSC_BUILD)
+#include <intrin.h>
+#elif defined(__GNUC__)
+#include <x86intrin.h>
+#else
+#error "Unsupported compiler"
+#endif
+
+void dml_avx2_dualcast(const uint8_t *src, uint8_t *dst1, uint8_t *dst2, uint32_t transfer_size)
+{
+    uint32_t i = 0u;
+
+    for (; (i + 64u) <= transfer_size; i += 64u)
+    {
+        const __m256i ymm0 = _mm256_loadu_si256((const __m256i *)(src + i));
+        const __m256i ymm1 = _mm256_loadu_si256((const __m256i *)(src + i + 32u));
+        _mm256_storeu_si256((__m256i *)(dst1 + i), ymm0);
+        _mm256_storeu_si256((__m256i *)(dst1 + i + 32u), ymm1);
+        _mm256_storeu_si256((__m256i *)(dst2 + i), ymm0);
+        _mm256_storeu_si256((__m256i *)(dst2 + i + 32u), ymm1);
+    }
+
+    for (; (i + 32u) <= transfer_size; i += 32u)
+    {
+        const __m256i ymm0 = _mm256_loadu_si256((const __m256i *)(src + i));
+        _mm256_storeu_si256((__m256i *)(dst1 + i), ymm0);
+        _mm256_storeu_si256((__m256i *)(dst2 + i), ymm0);
+    }
+
+    for (; i < transfer_size; ++i)
+    {
+        dst1[i] = src[i];
+        dst2[i] = src[i];
+    }
+}
@@ -0,0 +1,43 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "../dml_kernels.h"
+
+#if defined(_MSC_BUILD)
+#include <intrin.h>
+#elif defined(__GNUC__)
+#include <x86intrin.h>
+#else
+#error "Unsupported compiler"
+#endif
+
+void dml_avx2_fill_u64(uint64_t pattern, uint8_t *dst, uint32_t transfer_size)
+{
+    const uint8_t *const pattern_bytes = (const uint8_t *)&pattern;
+
+    uint32_t i = 0u;
+
+    // Stores start at multiples of the pattern size, so the same vector is used for every block
+    const __m256i ymm_pattern = _mm256_set1_epi64x((long long)pattern);
+
+    for (; (i + 128u) <= transfer_size; i += 128u)
+    {
+        _mm256_storeu_si256((__m256i *)(dst + i), ymm_pattern);
+        _mm256_storeu_si256((__m256i *)(dst + i + 32u), ymm_pattern);
+        _mm256_storeu_si256((__m256i *)(dst + i + 64u), ymm_pattern);
+        _mm256_storeu_si256((__m256i *)(dst + i + 96u), ymm_pattern);
+    }
+
+    for (; (i + 32u) <= transfer_size; i += 32u)
+    {
+        _mm256_storeu_si256((__m256i *)(dst + i), ymm_pattern);
+    }
+
+    for (; i < transfer_size; ++i)
+    {
+        dst[i] = pattern_bytes[i % sizeof(pattern)];
+    }
+}
@@ -0,0 +1,125 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "../dml_kernels.h"
+
+#if defined(_MSC_BUILD)
+#include <intrin.h>
+#elif defined(__GNUC__)
+#include <x86intrin.h>
+#else
+#error "Unsupported compiler"
+#endif
+
+static inline void copy_avx2(const uint8_t *src, uint8_t *dst, uint32_t transfer_size)
+{
+    uint32_t i = 0u;
+
+    if (transfer_size >= 32u)
+    {
+        // The first block is stored unaligned, then the stores continue from an aligned destination
+        _mm256_storeu_si256((__m256i *)dst, _mm256_loadu_si256((const __m256i *)src));
+
+        i = 32u - (uint32_t)((uintptr_t)dst & 31u);
+
+        for (; (i + 128u) <= transfer_size; i += 128u)
+        {
+            __m256i ymm0 = _mm256_loadu_si256((const __m256i *)(src + i));
+            __m256i ymm1 = _mm256_loadu_si256((const __m256i *)(src + i + 32u));
+            __m256i ymm2 = _mm256_loadu_si256((const __m256i *)(src + i + 64u));
+            __m256i ymm3 = _mm256_loadu_si256((const __m256i *)(src + i + 96u));
+            _mm256_store_si256((__m256i *)(dst + i), ymm0);
+            _mm256_store_si256((__m256i *)(dst + i + 32u), ymm1);
+            _mm256_store_si256((__m256i *)(dst + i + 64u), ymm2);
+            _mm256_store_si256((__m256i *)(dst + i + 96u), ymm3);
+        }
+
+        for (; (i + 32u) <= transfer_size; i += 32u)
+        {
+            _mm256_store_si256((__m256i *)(dst + i), _mm256_loadu_si256((const __m256i *)(src + i)));
+        }
+    }
+
+    for (; i < transfer_size; ++i)
+    {
+        dst[i] = src[i];
+    }
+}
+
+static inline void copy_forward_avx2(const uint8_t *src, uint8_t *dst, uint32_t transfer_size)
+{
+    uint32_t i = 0u;
+
+    // Every block is loaded before it is stored, so a forward pass is safe for dst below src
+    for (; (i + 32u) <= transfer_size; i += 32u)
+    {
+        _mm256_storeu_si256((__m256i *)(dst + i), _mm256_loadu_si256((const __m256i *)(src + i)));
+    }
+
+    for (; i < transfer_size; ++i)
+    {
+        dst[i] = src[i];
+    }
+}
+
+static inline void copy_backward_avx2(const uint8_t *src, uint8_t *dst, uint32_t transfer_size)
+{
+    uint32_t i = transfer_size;
+
+    for (; (i & 31u) != 0u; --i)
+    {
+        dst[i - 1u] = src[i - 1u];
+    }
+
+    for (; i >= 32u; i -= 32u)
+    {
+        _mm256_storeu_si256((__m256i *)(dst + i - 32u), _mm256_loadu_si256((const __m256i *)(src + i - 32u)));
+    }
+}
+
+void dml_avx2_mem_move(const uint8_t *src, uint8_t *dst, uint32_t transfer_size)
+{
+    const uint8_t *const src_begin = src;
+    const uint8_t *const src_end   = src + transfer_size;
+    const uint8_t *const dst_begin = dst;
+    const uint8_t *const dst_end   = dst + transfer_size;
+
+    /*
+     * Either:
+     * src: |-------|
+     * dst:          |-------|
+     *
+     * OR:
+     * src:          |-------|
+     * dst: |-------|
+     *
+     * Copy is safe
+     */
+    if (src_end <= dst_begin || src_begin >= dst_end)
+    {
+        copy_avx2(src, dst, transfer_size);
+    }
+    /*
+     * src:     |-------|
+     * dst: |-------|
+     *
+     * Only forward copy is applicable
+     */
+    else if (dst_begin < src_begin)
+    {
+        copy_forward_avx2(src, dst, transfer_size);
+    }
+    /*
+     * src: |-------|
+     * dst:     |-------|
+     *
+     * Only backward copy is applicable, the same regions are left as is
+     */
+    else if (dst_begin > src_begin)
+    {
+        copy_backward_avx2(src, dst, transfer_size);
+    }
+}
@@ -0,0 +1,90 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "../dml_kernels.h"
+
+#if defined(_MSC_BUILD)
+#include <intrin.h>
+#elif defined(__GNUC__)
+#include <x86intrin.h>
+#else
+#error "Unsupported compiler"
+#endif
+
+#define OWN_NOTES_PER_STEP       8u
+#define OWN_PREFETCH_STEPS_AHEAD 8u
+
+void dml_avx512_apply_delta(const uint8_t *delta_record, uint8_t *dst, uint32_t delta_record_size)
+{
+    typedef uint64_t block_t;
+    typedef uint16_t offset_t;
+
+    const uint32_t delta_note_size   = sizeof(block_t) + sizeof(offset_t);
+    const uint32_t delta_notes_count = delta_record_size / delta_note_size;
+
+    if (0u == delta_notes_count)
+    {
+        return;
+    }
+
+    // A note is five words: the offset and four words of data. Eight notes span 40 words of two registers
+    const __m512i data_words   = _mm512_set_epi16(39, 38, 37, 36, 34, 33, 32, 31, 29, 28, 27, 26, 24, 23, 22, 21,
+                                                  19, 18, 17, 16, 14, 13, 12, 11, 9, 8, 7, 6, 4, 3, 2, 1);
+    const __m512i offset_words = _mm512_set_epi16(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                                                  0, 0, 0, 0, 0, 0, 0, 0, 35, 30, 25, 20, 15, 10, 5, 0);
+    const __m128i run_steps    = _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7);
+
+    // Records made by create_delta are sorted by offset, one note per cache line or more on average is dense
+    const offset_t first_offset = *(const offset_t *)delta_record;
+    const offset_t last_offset  = *(const offset_t *)(delta_record + (delta_notes_count - 1u) * delta_note_size);
+    const bool     dense        = (last_offset >= first_offset) &&
+                       ((uint32_t)(last_offset - first_offset) < delta_notes_count * OWN_NOTES_PER_STEP);
+
+    const uint32_t prefetch_distance = OWN_NOTES_PER_STEP * OWN_PREFETCH_STEPS_AHEAD;
+
+    block_t *const dst_u64 = (block_t *)dst;
+
+    uint32_t index = 0u;
+
+    for (; (index + OWN_NOTES_PER_STEP) <= delta_notes_count; index += OWN_NOTES_PER_STEP)
+    {
+        const uint8_t *const notes = delta_record + index * delta_note_size;
+
+        if (dense && (index + prefetch_distance) < delta_notes_count)
+        {
+            _mm_prefetch((const char *)(dst_u64 + *(const offset_t *)(notes + prefetch_distance * delta_note_size)), _MM_HINT_T0);
+        }
+
+        const __m512i low  = _mm512_loadu_si512((const void *)notes);
+        const __m512i high = _mm512_maskz_loadu_epi16((__mmask32)0xFFu, (const void *)(notes + 64u));
+
+        const __m128i offsets = _mm512_castsi512_si128(_mm512_permutex2var_epi16(low, offset_words, high));
+        const offset_t offset = (offset_t)_mm_cvtsi128_si32(offsets);
+
+        // Notes of consecutive blocks are written with a single store
+        const __m128i expected = _mm_add_epi16(_mm_set1_epi16((short)offset), run_steps);
+
+        if (offset <= (offset_t)(UINT16_MAX - (OWN_NOTES_PER_STEP - 1u)) && 0xFFFF == _mm_movemask_epi8(_mm_cmpeq_epi16(offsets, expected)))
+        {
+            _mm512_storeu_si512((void *)(dst_u64 + offset), _mm512_permutex2var_epi16(low, data_words, high));
+            continue;
+        }
+
+        for (uint32_t i = 0u; i < OWN_NOTES_PER_STEP; ++i)
+        {
+            const uint8_t *const delta_note_position = notes + delta_note_size * i;
+
+            dst_u64[*(const offset_t *)delta_note_position] = *(const block_t *)(delta_note_position + sizeof(offset_t));
+        }
+    }
+
+    for (; index < delta_notes_count; ++index)
+    {
+        const uint8_t *const delta_note_position = delta_record + (delta_note_size * index);
+
+        dst_u64[*(const offset_t *)delta_note_position] = *(const block_t *)(delta_note_position + sizeof(offset_t));
+    }
+}
@@ -0,0 +1,107 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "../dml_kernels.h"
+#include "crc_folding.h"
+
+/** Shorter buffers are copied first and then hashed by the regular kernel */
+#define OWN_FOLDING_MIN_SIZE 256u
+
+/**
+ * @brief Returns constants folding over the distance given in bytes, which is either 64 or 256
+ */
+static inline __m512i own_fold_constants(uint32_t distance, uint32_t polynomial)
+{
+    if (OWN_DEFAULT_POLYNOMIAL == polynomial)
+    {
+        return (64u == distance) ? _mm512_broadcast_i32x4(_mm_set_epi64x(OWN_DEFAULT_X576, OWN_DEFAULT_X512))
+                                 : _mm512_broadcast_i32x4(_mm_set_epi64x(OWN_DEFAULT_X2112, OWN_DEFAULT_X2048));
+    }
+
+    return _mm512_broadcast_i32x4(_mm_set_epi64x((long long)dml_ref_crc_shift_32u(1u, distance + 8u, polynomial),
+                                                 (long long)dml_ref_crc_shift_32u(1u, distance, polynomial)));
+}
+
+/*
+ * Same scheme as the PCLMUL kernel: 256 bytes are stored and folded per step into four registers of four lanes,
+ * which are then folded into one 64-byte remainder with the same CRC as the processed data
+ */
+static inline uint32_t own_copy_crc_32u(const uint8_t *src, uint8_t *dst, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial, bool reflect_data)
+{
+    uint32_t (*const crc_kernel)(const uint8_t *, uint32_t, uint32_t, uint32_t) =
+        reflect_data ? dml_pclmul_crc_reflected_u32 : dml_pclmul_crc_u32;
+
+    uint32_t i = 0u;
+
+    if (transfer_size >= OWN_FOLDING_MIN_SIZE)
+    {
+        const __m512i byte_order = own_reversed_byte_order();
+        const __m512i line_fold  = own_fold_constants(64u, polynomial);
+        const __m512i step_fold  = own_fold_constants(256u, polynomial);
+
+        __m512i zmm[4];
+
+        for (uint32_t line = 0u; line < 4u; ++line)
+        {
+            const __m512i data = _mm512_loadu_si512((const void *)(src + line * 64u));
+
+            _mm512_storeu_si512((void *)(dst + line * 64u), data);
+            zmm[line] = own_to_polynomial(data, byte_order, reflect_data);
+        }
+
+        zmm[0] = _mm512_xor_si512(zmm[0], _mm512_maskz_set1_epi32((__mmask16)0x8u, (int)crc_value));
+
+        for (i = 256u; (i + 256u) <= transfer_size; i += 256u)
+        {
+            for (uint32_t line = 0u; line < 4u; ++line)
+            {
+                const __m512i data = _mm512_loadu_si512((const void *)(src + i + line * 64u));
+
+                _mm512_storeu_si512((void *)(dst + i + line * 64u), data);
+                zmm[line] = own_fold_512(zmm[line], step_fold, own_to_polynomial(data, byte_order, reflect_data));
+            }
+        }
+
+        __m512i remainder = own_fold_512(zmm[0], line_fold, zmm[1]);
+        remainder         = own_fold_512(remainder, line_fold, zmm[2]);
+        remainder         = own_fold_512(remainder, line_fold, zmm[3]);
+
+        for (; (i + 64u) <= transfer_size; i += 64u)
+        {
+            const __m512i data = _mm512_loadu_si512((const void *)(src + i));
+
+            _mm512_storeu_si512((void *)(dst + i), data);
+            remainder = own_fold_512(remainder, line_fold, own_to_polynomial(data, byte_order, reflect_data));
+        }
+
+        uint8_t remainder_bytes[64];
+
+        _mm512_storeu_si512((void *)remainder_bytes, _mm512_shuffle_epi8(remainder, byte_order));
+
+        // The remainder already has the data bits in polynomial order
+        crc_value = dml_pclmul_crc_u32(remainder_bytes, sizeof(remainder_bytes), 0u, polynomial);
+    }
+
+    for (uint32_t j = i; j < transfer_size; j += 64u)
+    {
+        const uint32_t  length = (transfer_size - j < 64u) ? transfer_size - j : 64u;
+        const __mmask64 mask   = (length == 64u) ? ~(__mmask64)0u : (((__mmask64)1u << length) - 1u);
+
+        _mm512_mask_storeu_epi8((void *)(dst + j), mask, _mm512_maskz_loadu_epi8(mask, (const void *)(src + j)));
+    }
+
+    return crc_kernel(src + i, transfer_size - i, crc_value, polynomial);
+}
+
+uint32_t dml_avx512_copy_crc_u32(const uint8_t *src, uint8_t *dst, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial)
+{
+    return own_copy_crc_32u(src, dst, transfer_size, crc_value, polynomial, false);
+}
+
+uint32_t dml_avx512_copy_crc_reflected_u32(const uint8_t *src, uint8_t *dst, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial)
+{
+    return own_copy_crc_32u(src, dst, transfer_size, crc_value, polynomial, true);
+}
@@ -0,0 +1,125 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <string.h>
+
+#include "../dml_kernels.h"
+#include "crc_folding.h"
+
+/** x^512 and x^576 modulo DML_CRC16_T10_POLYNOMIAL */
+#define OWN_T10_X512 0x87E70000u
+#define OWN_T10_X576 0x371D0000u
+
+/** Blocks hashed at once, each one has its own accumulator to hide the carry-less multiply latency */
+#define OWN_LANE_COUNT 4u
+
+/*
+ * Every block is folded line by line into a 64-byte remainder with the same CRC, which is hashed together
+ * with the block tail by the regular kernel. Lines are also stored to the destination blocks if there are any
+ */
+static inline uint32_t own_crc16_t10_blocks(const uint8_t *src,
+                                            uint32_t       src_stride,
+                                            uint8_t       *dst,
+                                            uint32_t       dst_stride,
+                                            uint32_t       block_size,
+                                            uint32_t       block_count,
+                                            uint16_t       crc_seed,
+                                            uint16_t      *crcs)
+{
+    uint32_t block = 0u;
+
+    if (block_size >= 64u)
+    {
+        const __m512i  byte_order  = own_reversed_byte_order();
+        const __m512i  constants   = _mm512_broadcast_i32x4(_mm_set_epi64x(OWN_T10_X576, OWN_T10_X512));
+        const __m512i  seed        = _mm512_maskz_set1_epi32((__mmask16)0x8u, (int)((uint32_t)crc_seed << 16u));
+        const uint32_t folded_size = block_size & ~63u;
+        const uint32_t tail_size   = block_size - folded_size;
+
+        for (; (block + OWN_LANE_COUNT) <= block_count; block += OWN_LANE_COUNT)
+        {
+            const uint8_t *lines[OWN_LANE_COUNT];
+            uint8_t       *dst_lines[OWN_LANE_COUNT];
+            __m512i        accumulators[OWN_LANE_COUNT];
+
+            for (uint32_t lane = 0u; lane < OWN_LANE_COUNT; ++lane)
+            {
+                lines[lane]     = src + (size_t)(block + lane) * src_stride;
+                dst_lines[lane] = (dst != NULL) ? dst + (size_t)(block + lane) * dst_stride : NULL;
+
+                const __m512i data = _mm512_loadu_si512((const void *)lines[lane]);
+
+                accumulators[lane] = _mm512_xor_si512(own_to_polynomial(data, byte_order, false), seed);
+
+                if (dst != NULL)
+                {
+                    _mm512_storeu_si512((void *)dst_lines[lane], data);
+                }
+            }
+
+            for (uint32_t i = 64u; i < folded_size; i += 64u)
+            {
+                for (uint32_t lane = 0u; lane < OWN_LANE_COUNT; ++lane)
+                {
+                    const __m512i data = _mm512_loadu_si512((const void *)(lines[lane] + i));
+
+                    if (dst != NULL)
+                    {
+                        _mm512_storeu_si512((void *)(dst_lines[lane] + i), data);
+                    }
+
+                    accumulators[lane] = own_fold_512(accumulators[lane], constants, own_to_polynomial(data, byte_order, false));
+                }
+            }
+
+            for (uint32_t lane = 0u; lane < OWN_LANE_COUNT; ++lane)
+            {
+                uint8_t remainder[128];
+
+                _mm512_storeu_si512((void *)remainder, own_to_polynomial(accumulators[lane], byte_order, false));
+                memcpy(remainder + 64u, lines[lane] + folded_size, tail_size);
+
+                if (dst != NULL)
+                {
+                    memcpy(dst_lines[lane] + folded_size, remainder + 64u, tail_size);
+                }
+
+                crcs[block + lane] = (uint16_t)(dml_pclmul_crc_u32(remainder, 64u + tail_size, 0u, DML_CRC16_T10_POLYNOMIAL) >> 16u);
+            }
+        }
+    }
+
+    return block;
+}
+
+void dml_avx512_crc16_t10_blocks(const uint8_t *src, uint32_t block_size, uint32_t stride, uint32_t block_count, uint16_t crc_seed, uint16_t *crcs)
+{
+    const uint32_t block = own_crc16_t10_blocks(src, stride, NULL, 0u, block_size, block_count, crc_seed, crcs);
+
+    dml_pclmul_crc16_t10_blocks(src + (size_t)block * stride, block_size, stride, block_count - block, crc_seed, crcs + block);
+}
+
+void dml_avx512_copy_crc16_t10_blocks(const uint8_t *src,
+                                      uint32_t       src_stride,
+                                      uint8_t       *dst,
+                                      uint32_t       dst_stride,
+                                      uint32_t       block_size,
+                                      uint32_t       block_count,
+                                      uint16_t       crc_seed,
+                                      uint16_t      *crcs)
+{
+    const uint32_t block = own_crc16_t10_blocks(src, src_stride, dst, dst_stride, block_size, block_count, crc_seed, crcs);
+
+    dml_pclmul_copy_crc16_t10_blocks(src + (size_t)block * src_stride,
+                                     src_stride,
+                                     dst + (size_t)block * dst_stride,
+                                     dst_stride,
+                                     block_size,
+                                     block_count - block,
+                                     crc_seed,
+                                     crcs + block);
+}
@@ -0,0 +1,79 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef DML_CORE_OWN_KERNELS_AVX512_CRC_FOLDING_H
+#define DML_CORE_OWN_KERNELS_AVX512_CRC_FOLDING_H
+
+#include <stdbool.h>
+
+#if defined(_MSC_BUILD)
+#include <intrin.h>
+#elif defined(__GNUC__)
+#include <x86intrin.h>
+#else
+#error "Unsupported compiler"
+#endif
+
+/** Default polynomial of the CRC operations and x^d modulo it, other polynomials get their constants computed */
+#define OWN_DEFAULT_POLYNOMIAL 0x1EDC6F41u
+#define OWN_DEFAULT_X64        0x3AAB4576u
+#define OWN_DEFAULT_X96        0xD7A01665u
+#define OWN_DEFAULT_X128       0x18571D18u
+#define OWN_DEFAULT_X192       0x6503EA99u
+#define OWN_DEFAULT_X256       0x59A3508Au
+#define OWN_DEFAULT_X320       0x7BBA6798u
+#define OWN_DEFAULT_X384       0xE6957B4Du
+#define OWN_DEFAULT_X448       0xAA5EEC4Au
+#define OWN_DEFAULT_X512       0xAA97D41Du
+#define OWN_DEFAULT_X576       0xA6955F31u
+#define OWN_DEFAULT_X2048      0x4EF6A711u
+#define OWN_DEFAULT_X2112      0xFA374B2Eu
+#define OWN_DEFAULT_BARRETT    0x11F91CAF6ull
+
+/**
+ * @brief Returns the shuffle that reverses the bytes of every 16-byte lane
+ */
+static inline __m512i own_reversed_byte_order(void)
+{
+    return _mm512_broadcast_i32x4(_mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
+}
+
+/**
+ * @brief Reverses the bit order of every byte
+ */
+static inline __m512i own_reflect_bytes(__m512i data)
+{
+    const __m512i low_nibbles  = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(0x00, (char)0x80, 0x40, (char)0xC0, 0x20, (char)0xA0, 0x60, (char)0xE0, 0x10, (char)0x90, 0x50, (char)0xD0, 0x30, (char)0xB0, 0x70, (char)0xF0));
+    const __m512i high_nibbles = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(0x00, 0x08, 0x04, 0x0C, 0x02, 0x0A, 0x06, 0x0E, 0x01, 0x09, 0x05, 0x0D, 0x03, 0x0B, 0x07, 0x0F));
+    const __m512i nibble_mask  = _mm512_set1_epi8(0x0F);
+
+    return _mm512_or_si512(_mm512_shuffle_epi8(low_nibbles, _mm512_and_si512(data, nibble_mask)),
+                           _mm512_shuffle_epi8(high_nibbles, _mm512_and_si512(_mm512_srli_epi16(data, 4), nibble_mask)));
+}
+
+/**
+ * @brief Turns every 16 bytes into a polynomial with the first bit of the first byte as the highest coefficient,
+ *        byte_order is @ref own_reversed_byte_order
+ */
+static inline __m512i own_to_polynomial(__m512i data, __m512i byte_order, bool reflect_data)
+{
+    return _mm512_shuffle_epi8(reflect_data ? own_reflect_bytes(data) : data, byte_order);
+}
+
+/**
+ * @brief Returns polynomials congruent to accumulator * x^d + data, high qwords of constants are x^(d + 64), low ones are x^d
+ */
+static inline __m512i own_fold_512(__m512i accumulator, __m512i constants, __m512i data)
+{
+    const __m512i high = _mm512_clmulepi64_epi128(accumulator, constants, 0x11);
+    const __m512i low  = _mm512_clmulepi64_epi128(accumulator, constants, 0x00);
+
+    return _mm512_ternarylogic_epi64(high, low, data, 0x96);
+}
+
+#endif  //DML_CORE_OWN_KERNELS_AVX512_CRC_FOLDING_H
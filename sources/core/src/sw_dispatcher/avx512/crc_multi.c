@@ -0,0 +1,188 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "../dml_kernels.h"
+#include "crc_folding.h"
+
+/** Buffers hashed at once, each one has its own accumulator to hide the carry-less multiply latency */
+#define OWN_STREAM_COUNT 4u
+
+typedef struct
+{
+    __m512i fold_512;  /**< x^576 and x^512 in every lane, moves a line one line further */
+    __m512i fold_lane; /**< x^(d + 64) and x^d, moves every lane to the end of the line */
+    __m512i reduce;    /**< x^64 and x^96, reduce a lane to 64 bits */
+    __m512i barrett;   /**< The polynomial and floor(x^64 / P), reduce 64 bits to the CRC */
+} own_constants_t;
+
+static inline uint64_t own_barrett_constant(uint32_t polynomial)
+{
+    // Long division of x^64 by x^32 + polynomial, the first step leaves x^32 * polynomial
+    const uint64_t divisor   = (1ull << 32u) | polynomial;
+    uint64_t       quotient  = 1ull << 32u;
+    uint64_t       remainder = polynomial;
+
+    for (int32_t bit = 31; bit >= 0; --bit)
+    {
+        remainder <<= 1u;
+
+        if (remainder & (1ull << 32u))
+        {
+            quotient |= 1ull << (uint32_t)bit;
+            remainder ^= divisor;
+        }
+    }
+
+    return quotient;
+}
+
+static inline own_constants_t own_get_constants(uint32_t polynomial)
+{
+    own_constants_t constants;
+
+    if (OWN_DEFAULT_POLYNOMIAL == polynomial)
+    {
+        constants.fold_512  = _mm512_broadcast_i32x4(_mm_set_epi64x(OWN_DEFAULT_X576, OWN_DEFAULT_X512));
+        constants.fold_lane = _mm512_set_epi64(OWN_DEFAULT_X64, 1, OWN_DEFAULT_X192, OWN_DEFAULT_X128,
+                                               OWN_DEFAULT_X320, OWN_DEFAULT_X256, OWN_DEFAULT_X448, OWN_DEFAULT_X384);
+        constants.reduce    = _mm512_broadcast_i32x4(_mm_set_epi64x(OWN_DEFAULT_X64, OWN_DEFAULT_X96));
+        constants.barrett   = _mm512_broadcast_i32x4(_mm_set_epi64x(OWN_DEFAULT_POLYNOMIAL, (long long)OWN_DEFAULT_BARRETT));
+
+        return constants;
+    }
+
+    // x^(8 * n) modulo the polynomial
+#define OWN_X(n) ((long long)dml_ref_crc_shift_32u(1u, (n), polynomial))
+    constants.fold_512  = _mm512_broadcast_i32x4(_mm_set_epi64x(OWN_X(72u), OWN_X(64u)));
+    constants.fold_lane = _mm512_set_epi64(OWN_X(8u), 1, OWN_X(24u), OWN_X(16u), OWN_X(40u), OWN_X(32u), OWN_X(56u), OWN_X(48u));
+    constants.reduce    = _mm512_broadcast_i32x4(_mm_set_epi64x(OWN_X(8u), OWN_X(12u)));
+    constants.barrett   = _mm512_broadcast_i32x4(_mm_set_epi64x(polynomial, (long long)own_barrett_constant(polynomial)));
+#undef OWN_X
+
+    return constants;
+}
+
+/**
+ * @brief Folds the four lanes of a line into one and XORs them, the result is congruent to the line modulo the polynomial
+ */
+static inline __m128i own_fold_lanes(__m512i accumulator, __m512i constants)
+{
+    const __m512i lanes = _mm512_xor_si512(_mm512_clmulepi64_epi128(accumulator, constants, 0x11),
+                                           _mm512_clmulepi64_epi128(accumulator, constants, 0x00));
+    const __m256i halves = _mm256_xor_si256(_mm512_castsi512_si256(lanes), _mm512_extracti64x4_epi64(lanes, 1));
+
+    return _mm_xor_si128(_mm256_castsi256_si128(halves), _mm256_extracti128_si256(halves, 1));
+}
+
+/**
+ * @brief Returns the CRC of every 96-bit lane, that is the lane times x^32 modulo the polynomial, in the first dword of the lane
+ */
+static inline __m512i own_reduce_lanes(__m512i lanes, const own_constants_t *constants)
+{
+    // Top 32 bits times x^96 plus the low 64 bits times x^32, at most 96 bits
+    const __m512i low    = _mm512_bslli_epi128(_mm512_maskz_mov_epi64(0x55, lanes), 4);
+    const __m512i folded = _mm512_xor_si512(_mm512_clmulepi64_epi128(lanes, constants->reduce, 0x01), low);
+
+    // Top 32 bits times x^64 plus the low 64 bits
+    const __m512i value = _mm512_xor_si512(_mm512_clmulepi64_epi128(folded, constants->reduce, 0x11),
+                                           _mm512_maskz_mov_epi64(0x55, folded));
+
+    // Barrett reduction of the 64-bit value
+    const __m512i quotient =
+        _mm512_srli_epi64(_mm512_clmulepi64_epi128(_mm512_srli_epi64(value, 32), constants->barrett, 0x00), 32);
+
+    return _mm512_xor_si512(value, _mm512_clmulepi64_epi128(quotient, constants->barrett, 0x10));
+}
+
+/*
+ * Buffers are taken four at a time and the 64-byte lines all four of them have are folded in lockstep, one register
+ * per buffer. The registers are then reduced to the CRCs of the folded parts side by side, one lane per buffer, and
+ * the rest of every buffer continues from that CRC in the regular kernel
+ */
+static inline void own_crc_multi_32u(const uint8_t *const *srcs,
+                                     const uint32_t       *sizes,
+                                     uint32_t              count,
+                                     uint32_t             *crcs,
+                                     uint32_t              polynomial,
+                                     bool                  reflect_data)
+{
+    uint32_t (*const crc_kernel)(const uint8_t *, uint32_t, uint32_t, uint32_t) =
+        reflect_data ? dml_pclmul_crc_reflected_u32 : dml_pclmul_crc_u32;
+
+    const __m512i byte_order = own_reversed_byte_order();
+    const own_constants_t constants = own_get_constants(polynomial);
+
+    uint32_t first = 0u;
+
+    for (; (first + OWN_STREAM_COUNT) <= count; first += OWN_STREAM_COUNT)
+    {
+        uint32_t folded_size = sizes[first];
+
+        for (uint32_t stream = 1u; stream < OWN_STREAM_COUNT; ++stream)
+        {
+            folded_size = (sizes[first + stream] < folded_size) ? sizes[first + stream] : folded_size;
+        }
+
+        folded_size &= ~63u;
+
+        if (0u != folded_size)
+        {
+            __m512i accumulators[OWN_STREAM_COUNT];
+
+            for (uint32_t stream = 0u; stream < OWN_STREAM_COUNT; ++stream)
+            {
+                const __m512i data = _mm512_loadu_si512((const void *)srcs[first + stream]);
+                const __m512i seed = _mm512_maskz_set1_epi32((__mmask16)0x8u, (int)crcs[first + stream]);
+
+                accumulators[stream] = _mm512_xor_si512(own_to_polynomial(data, byte_order, reflect_data), seed);
+            }
+
+            for (uint32_t i = 64u; i < folded_size; i += 64u)
+            {
+                for (uint32_t stream = 0u; stream < OWN_STREAM_COUNT; ++stream)
+                {
+                    const __m512i data = _mm512_loadu_si512((const void *)(srcs[first + stream] + i));
+
+                    accumulators[stream] =
+                        own_fold_512(accumulators[stream], constants.fold_512, own_to_polynomial(data, byte_order, reflect_data));
+                }
+            }
+
+            // Lanes of every buffer are folded into one and the four buffers are reduced together
+            __m512i lanes = _mm512_castsi128_si512(own_fold_lanes(accumulators[0], constants.fold_lane));
+
+            lanes = _mm512_inserti32x4(lanes, own_fold_lanes(accumulators[1], constants.fold_lane), 1);
+            lanes = _mm512_inserti32x4(lanes, own_fold_lanes(accumulators[2], constants.fold_lane), 2);
+            lanes = _mm512_inserti32x4(lanes, own_fold_lanes(accumulators[3], constants.fold_lane), 3);
+
+            _mm_storeu_si128((__m128i *)(crcs + first),
+                             _mm512_castsi512_si128(_mm512_maskz_compress_epi32(0x1111, own_reduce_lanes(lanes, &constants))));
+        }
+
+        for (uint32_t j = first; j < first + OWN_STREAM_COUNT; ++j)
+        {
+            if (sizes[j] != folded_size)
+            {
+                crcs[j] = crc_kernel(srcs[j] + folded_size, sizes[j] - folded_size, crcs[j], polynomial);
+            }
+        }
+    }
+
+    for (; first < count; ++first)
+    {
+        crcs[first] = crc_kernel(srcs[first], sizes[first], crcs[first], polynomial);
+    }
+}
+
+void dml_avx512_crc_multi_u32(const uint8_t *const *srcs, const uint32_t *sizes, uint32_t count, uint32_t *crcs, uint32_t polynomial)
+{
+    own_crc_multi_32u(srcs, sizes, count, crcs, polynomial, false);
+}
+
+void dml_avx512_crc_multi_reflected_u32(const uint8_t *const *srcs, const uint32_t *sizes, uint32_t count, uint32_t *crcs, uint32_t polynomial)
+{
+    own_crc_multi_32u(srcs, sizes, count, crcs, polynomial, true);
+}
@@ -0,0 +1,85 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "../dml_kernels.h"
+
+#if defined(_MSC_BUILD)
+#include <intrin.h>
+#elif defined(__GNUC__)
+#include <x86intrin.h>
+#else
+#error "Unsupported compiler"
+#endif
+
+uint32_t dml_avx512_create_delta(const uint8_t *src1,
+                                 const uint8_t *src2,
+                                 uint32_t       transfer_size,
+                                 uint8_t       *delta_record,
+                                 uint32_t       delta_record_max_size,
+                                 uint8_t       *result)
+{
+    typedef uint64_t block_t;
+    typedef uint16_t offset_t;
+
+    const uint32_t delta_note_size = sizeof(block_t) + sizeof(offset_t);
+    const uint32_t block_count     = transfer_size / sizeof(block_t);
+    const uint8_t  overflow        = 0x2;
+
+    const __m512i lane_offsets = _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0);
+
+    uint32_t delta_record_size = 0u;
+
+    // Eight blocks are compared at once, the differing ones are packed together before the notes are written
+    for (uint32_t index = 0u; index < block_count; index += 8u)
+    {
+        const uint32_t  remaining = block_count - index;
+        const __mmask8  load_mask = (remaining >= 8u) ? (__mmask8)0xFFu : (__mmask8)((1u << remaining) - 1u);
+        const __m512i   zmm1      = _mm512_maskz_loadu_epi64(load_mask, (const void *)(src1 + index * sizeof(block_t)));
+        const __m512i   zmm2      = _mm512_maskz_loadu_epi64(load_mask, (const void *)(src2 + index * sizeof(block_t)));
+        const __mmask8  mismatch  = _mm512_mask_cmpneq_epi64_mask(load_mask, zmm1, zmm2);
+
+        if (!mismatch)
+        {
+            continue;
+        }
+
+        block_t  blocks[8];
+        uint64_t offsets[8];
+
+        _mm512_storeu_si512((void *)blocks, _mm512_maskz_compress_epi64(mismatch, zmm2));
+        _mm512_storeu_si512((void *)offsets,
+                            _mm512_maskz_compress_epi64(mismatch, _mm512_add_epi64(lane_offsets, _mm512_set1_epi64(index))));
+
+        const uint32_t note_count = (uint32_t)_mm_popcnt_u32((uint32_t)mismatch);
+        const uint32_t note_space = (delta_record_max_size > delta_record_size)
+                                        ? (delta_record_max_size - delta_record_size) / delta_note_size
+                                        : 0u;
+        const uint32_t notes      = (note_count < note_space) ? note_count : note_space;
+
+        for (uint32_t i = 0u; i < notes; ++i)
+        {
+            uint8_t *const delta_position = delta_record + delta_record_size;
+
+            *(offset_t *)delta_position                     = (offset_t)offsets[i];
+            *(block_t *)(delta_position + sizeof(offset_t)) = blocks[i];
+
+            delta_record_size += delta_note_size;
+        }
+
+        if (notes < note_count)
+        {
+            *result = overflow;
+            return delta_record_size;
+        }
+    }
+
+    const uint8_t equal     = 0x0;
+    const uint8_t not_equal = 0x1;
+
+    *result = delta_record_size ? not_equal : equal;
+
+    return delta_record_size;
+}
@@ -0,0 +1,80 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "../dml_kernels.h"
+
+#if defined(_MSC_BUILD)
+#include <intrin.h>
+#elif defined(__GNUC__)
+#include <x86intrin.h>
+#else
+#error "Unsupported compiler"
+#endif
+
+/** Shorter transfers are copied with regular stores */
+#define OWN_NON_TEMPORAL_MIN_SIZE 256u
+
+static inline void own_dualcast(const uint8_t *src, uint8_t *dst1, uint8_t *dst2, uint32_t transfer_size, bool non_temporal)
+{
+    uint32_t i = 0u;
+
+    // Streaming stores need aligned destinations, both get aligned at once if they share the offset in a line
+    if (non_temporal && transfer_size >= OWN_NON_TEMPORAL_MIN_SIZE && 0u == (((uintptr_t)dst1 ^ (uintptr_t)dst2) & 63u))
+    {
+        const uint32_t head = (64u - ((uintptr_t)dst1 & 63u)) & 63u;
+
+        if (head)
+        {
+            const __mmask64 mask = ((__mmask64)1u << head) - 1u;
+            const __m512i   zmm0 = _mm512_maskz_loadu_epi8(mask, (const void *)src);
+
+            _mm512_mask_storeu_epi8((void *)dst1, mask, zmm0);
+            _mm512_mask_storeu_epi8((void *)dst2, mask, zmm0);
+
+            i = head;
+        }
+
+        for (; (i + 128u) <= transfer_size; i += 128u)
+        {
+            const __m512i zmm0 = _mm512_loadu_si512((const void *)(src + i));
+            const __m512i zmm1 = _mm512_loadu_si512((const void *)(src + i + 64u));
+
+            _mm512_stream_si512((void *)(dst1 + i), zmm0);
+            _mm512_stream_si512((void *)(dst1 + i + 64u), zmm1);
+            _mm512_stream_si512((void *)(dst2 + i), zmm0);
+            _mm512_stream_si512((void *)(dst2 + i + 64u), zmm1);
+        }
+
+        _mm_sfence();
+    }
+
+    for (; (i + 64u) <= transfer_size; i += 64u)
+    {
+        const __m512i zmm0 = _mm512_loadu_si512((const void *)(src + i));
+
+        _mm512_storeu_si512((void *)(dst1 + i), zmm0);
+        _mm512_storeu_si512((void *)(dst2 + i), zmm0);
+    }
+
+    if (i < transfer_size)
+    {
+        const __mmask64 mask = ((__mmask64)1u << (transfer_size - i)) - 1u;
+        const __m512i   zmm0 = _mm512_maskz_loadu_epi8(mask, (const void *)(src + i));
+
+        _mm512_mask_storeu_epi8((void *)(dst1 + i), mask, zmm0);
+        _mm512_mask_storeu_epi8((void *)(dst2 + i), mask, zmm0);
+    }
+}
+
+void dml_avx512_dualcast(const uint8_t *src, uint8_t *dst1, uint8_t *dst2, uint32_t transfer_size)
+{
+    own_dualcast(src, dst1, dst2, transfer_size, false);
+}
+
+void dml_avx512_dualcast_nt(const uint8_t *src, uint8_t *dst1, uint8_t *dst2, uint32_t transfer_size)
+{
+    own_dualcast(src, dst1, dst2, transfer_size, true);
+}
@@ -99,3 +99,53 @@ void dml_avx512_fill_u64(uint64_t pattern, uint8_t *dst, uint32_t transfer_size)
     dml_ref_fill_u64(pattern, dst, transfer_size);
 }
 #endif
+
+/** Shorter transfers are filled with regular stores */
+#define OWN_NON_TEMPORAL_MIN_SIZE 256u
+
+void dml_avx512_fill_u64_nt(uint64_t pattern, uint8_t *dst, uint32_t transfer_size)
+{
+    if (transfer_size < OWN_NON_TEMPORAL_MIN_SIZE)
+    {
+        dml_avx512_fill_u64(pattern, dst, transfer_size);
+        return;
+    }
+
+    uint32_t i = (64u - ((uintptr_t)dst & 63u)) & 63u;
+
+    if (i)
+    {
+        _mm512_mask_storeu_epi8((void *)dst, ((__mmask64)1u << i) - 1u, _mm512_set1_epi64((long long)pattern));
+
+        // The aligned part starts in the middle of the pattern
+        const uint32_t shift = (i % 8u) * 8u;
+
+        if (shift)
+        {
+            pattern = (pattern >> shift) | (pattern << (64u - shift));
+        }
+    }
+
+    const __m512i zmm_pattern = _mm512_set1_epi64((long long)pattern);
+
+    for (; (i + 256u) <= transfer_size; i += 256u)
+    {
+        _mm512_stream_si512((void *)(dst + i), zmm_pattern);
+        _mm512_stream_si512((void *)(dst + i + 64u), zmm_pattern);
+        _mm512_stream_si512((void *)(dst + i + 128u), zmm_pattern);
+        _mm512_stream_si512((void *)(dst + i + 192u), zmm_pattern);
+    }
+
+    for (; (i + 64u) <= transfer_size; i += 64u)
+    {
+        _mm512_stream_si512((void *)(dst + i), zmm_pattern);
+    }
+
+    if (i < transfer_size)
+    {
+        _mm512_mask_storeu_epi8((void *)(dst + i), ((__mmask64)1u << (transfer_size - i)) - 1u, zmm_pattern);
+    }
+
+    // Streaming stores are weakly ordered, so they are fenced before the fill is reported as done
+    _mm_sfence();
+}
@@ -850,3 +850,53 @@ void dml_avx512_mem_move(const uint8_t *src, uint8_t *dst, uint32_t transfer_siz
         dml_ref_mem_move(src, dst, transfer_size);
     }
 }
+
+/** Shorter transfers are copied with regular stores */
+#define OWN_NON_TEMPORAL_MIN_SIZE 256u
+
+void dml_avx512_mem_move_nt(const uint8_t *src, uint8_t *dst, uint32_t transfer_size)
+{
+    // Streaming stores skip the read for ownership, so only the copy of non-overlapping buffers uses them
+    if (transfer_size < OWN_NON_TEMPORAL_MIN_SIZE || !(src + transfer_size <= dst || dst + transfer_size <= src))
+    {
+        dml_avx512_mem_move(src, dst, transfer_size);
+        return;
+    }
+
+    uint32_t i = (64u - ((uintptr_t)dst & 63u)) & 63u;
+
+    if (i)
+    {
+        const __mmask64 mask = ((__mmask64)1u << i) - 1u;
+
+        _mm512_mask_storeu_epi8((void *)dst, mask, _mm512_maskz_loadu_epi8(mask, (const void *)src));
+    }
+
+    for (; (i + 256u) <= transfer_size; i += 256u)
+    {
+        const __m512i zmm0 = _mm512_loadu_si512((const void *)(src + i));
+        const __m512i zmm1 = _mm512_loadu_si512((const void *)(src + i + 64u));
+        const __m512i zmm2 = _mm512_loadu_si512((const void *)(src + i + 128u));
+        const __m512i zmm3 = _mm512_loadu_si512((const void *)(src + i + 192u));
+
+        _mm512_stream_si512((void *)(dst + i), zmm0);
+        _mm512_stream_si512((void *)(dst + i + 64u), zmm1);
+        _mm512_stream_si512((void *)(dst + i + 128u), zmm2);
+        _mm512_stream_si512((void *)(dst + i + 192u), zmm3);
+    }
+
+    for (; (i + 64u) <= transfer_size; i += 64u)
+    {
+        _mm512_stream_si512((void *)(dst + i), _mm512_loadu_si512((const void *)(src + i)));
+    }
+
+    if (i < transfer_size)
+    {
+        const __mmask64 mask = ((__mmask64)1u << (transfer_size - i)) - 1u;
+
+        _mm512_mask_storeu_epi8((void *)(dst + i), mask, _mm512_maskz_loadu_epi8(mask, (const void *)(src + i)));
+    }
+
+    // Streaming stores are weakly ordered, the fence makes them visible before the operation completes
+    _mm_sfence();
+}
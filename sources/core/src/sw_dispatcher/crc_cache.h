@@ -0,0 +1,94 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef DML_CORE_OWN_KERNELS_CRC_CACHE_H
+#define DML_CORE_OWN_KERNELS_CRC_CACHE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+/**
+ * @brief Header of data a CRC kernel derives from a polynomial, the payload follows it in the same allocation
+ */
+typedef struct
+{
+    uint32_t polynomial;
+} own_crc_cache_entry_t;
+
+/**
+ * @brief Allocates and fills an entry for the polynomial, returns NULL if no memory is available
+ */
+typedef own_crc_cache_entry_t *(*own_crc_cache_build_t)(uint32_t polynomial);
+
+static inline own_crc_cache_entry_t *own_crc_cache_load(own_crc_cache_entry_t *volatile *slot)
+{
+#if defined(_MSC_VER)
+    return (own_crc_cache_entry_t *)_InterlockedCompareExchangePointer((void *volatile *)slot, NULL, NULL);
+#else
+    return __atomic_load_n(slot, __ATOMIC_ACQUIRE);
+#endif
+}
+
+static inline bool own_crc_cache_publish(own_crc_cache_entry_t *volatile *slot, own_crc_cache_entry_t *entry)
+{
+#if defined(_MSC_VER)
+    return _InterlockedCompareExchangePointer((void *volatile *)slot, entry, NULL) == NULL;
+#else
+    own_crc_cache_entry_t *expected = NULL;
+    return __atomic_compare_exchange_n(slot, &expected, entry, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+#endif
+}
+
+/**
+ * @brief Returns the cached entry of the polynomial, building it on first use
+ *
+ * Entries are never freed, so lookups take no locks: a slot only ever changes from NULL to a complete entry.
+ * Returns NULL if all slots hold other polynomials or no memory is available.
+ */
+static inline const own_crc_cache_entry_t *own_crc_cache_get(own_crc_cache_entry_t *volatile *slots,
+                                                             uint32_t                         slot_count,
+                                                             uint32_t                         polynomial,
+                                                             own_crc_cache_build_t            build)
+{
+    for (uint32_t i = 0u; i < slot_count; ++i)
+    {
+        own_crc_cache_entry_t *entry = own_crc_cache_load(&slots[i]);
+
+        if (entry == NULL)
+        {
+            own_crc_cache_entry_t *new_entry = build(polynomial);
+
+            if (new_entry == NULL)
+            {
+                return NULL;
+            }
+
+            if (own_crc_cache_publish(&slots[i], new_entry))
+            {
+                return new_entry;
+            }
+
+            // Another thread took the slot first, it may hold the same polynomial
+            free(new_entry);
+            entry = own_crc_cache_load(&slots[i]);
+        }
+
+        if (entry->polynomial == polynomial)
+        {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+#endif  //DML_CORE_OWN_KERNELS_CRC_CACHE_H
@@ -15,8 +15,13 @@ typedef unsigned dml_register_t;
 
 #include <stddef.h>
 
+#define DML_CPUID_FEATURES   0x1
 #define DML_CPUID_EXTENSIONS 0x7
 
+#define DML_PCLMULQDQ (1 << 1)
+#define DML_SSE42     (1 << 20)
+
+#define DML_AVX2     (1 << 5)
 #define DML_AVX512F  (1 << 16)
 #define DML_AVX512DQ (1 << 17)
 #define DML_AVX512CD (1 << 28)
@@ -28,6 +33,8 @@ typedef unsigned dml_register_t;
 #define DML_CLFLUSHOPT (1 << 23)
 #define DML_CLWB       (1 << 24)
 #define DML_WAITPKG    (1 << 5)
+#define DML_VPCLMULQDQ (1 << 10)
+#define DML_MOVDIR64B  (1 << 28)
 
 #ifdef __cplusplus
 extern "C" {
@@ -16,18 +16,30 @@ extern "C" {
 
 void dml_ref_mem_move(const uint8_t *src, uint8_t *dst, uint32_t transfer_size);
 
+void dml_avx2_mem_move(const uint8_t *src, uint8_t *dst, uint32_t transfer_size);
+
 void dml_avx512_mem_move(const uint8_t *src, uint8_t *dst, uint32_t transfer_size);
 
+void dml_avx512_mem_move_nt(const uint8_t *src, uint8_t *dst, uint32_t transfer_size);
+
 void dml_ref_fill_u64(uint64_t pattern, uint8_t *dst, uint32_t transfer_size);
 
+void dml_avx2_fill_u64(uint64_t pattern, uint8_t *dst, uint32_t transfer_size);
+
 void dml_avx512_fill_u64(uint64_t pattern, uint8_t *dst, uint32_t transfer_size);
 
+void dml_avx512_fill_u64_nt(uint64_t pattern, uint8_t *dst, uint32_t transfer_size);
+
 uint32_t dml_ref_compare(const uint8_t *src1, const uint8_t *src2, uint32_t transfer_size, uint8_t *result);
 
+uint32_t dml_avx2_compare(const uint8_t *src1, const uint8_t *src2, uint32_t transfer_size, uint8_t *result);
+
 uint32_t dml_avx512_compare(const uint8_t *src1, const uint8_t *src2, uint32_t transfer_size, uint8_t *result);
 
 uint32_t dml_ref_compare_pattern(uint64_t pattern, const uint8_t *src, uint32_t transfer_size, uint8_t *result);
 
+uint32_t dml_avx2_compare_pattern(uint64_t pattern, const uint8_t *src, uint32_t transfer_size, uint8_t *result);
+
 uint32_t dml_avx512_compare_pattern(uint64_t pattern, const uint8_t *src, uint32_t transfer_size, uint8_t *result);
 
 uint32_t dml_ref_create_delta(const uint8_t *src1,
@@ -37,17 +49,101 @@ uint32_t dml_ref_create_delta(const uint8_t *src1,
                               uint32_t       max_delta_record_size,
                               uint8_t       *result);
 
+uint32_t dml_avx2_create_delta(const uint8_t *src1,
+                               const uint8_t *src2,
+                               uint32_t       transfer_size,
+                               uint8_t       *delta_record,
+                               uint32_t       max_delta_record_size,
+                               uint8_t       *result);
+
+uint32_t dml_avx512_create_delta(const uint8_t *src1,
+                                 const uint8_t *src2,
+                                 uint32_t       transfer_size,
+                                 uint8_t       *delta_record,
+                                 uint32_t       max_delta_record_size,
+                                 uint8_t       *result);
+
 void dml_ref_apply_delta(const uint8_t *delta_record, uint8_t *dst, uint32_t delta_record_size);
 
+void dml_avx512_apply_delta(const uint8_t *delta_record, uint8_t *dst, uint32_t delta_record_size);
+
 void dml_ref_dualcast(const uint8_t *src, uint8_t *dst1, uint8_t *dst2, uint32_t transfer_size);
 
+void dml_avx2_dualcast(const uint8_t *src, uint8_t *dst1, uint8_t *dst2, uint32_t transfer_size);
+
+void dml_avx512_dualcast(const uint8_t *src, uint8_t *dst1, uint8_t *dst2, uint32_t transfer_size);
+
+void dml_avx512_dualcast_nt(const uint8_t *src, uint8_t *dst1, uint8_t *dst2, uint32_t transfer_size);
+
 uint32_t dml_ref_crc_32u(const uint8_t *src, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial);
 
-uint32_t dml_avx512_crc_u32(const uint8_t *src, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial);
+uint32_t dml_pclmul_crc_u32(const uint8_t *src, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial);
 
 uint32_t dml_ref_crc_reflected_u32(const uint8_t *src, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial);
 
-uint32_t dml_avx512_crc_reflected_u32(const uint8_t* src, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial);
+uint32_t dml_pclmul_crc_reflected_u32(const uint8_t *src, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial);
+
+uint32_t dml_ref_copy_crc_u32(const uint8_t *src, uint8_t *dst, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial);
+
+uint32_t dml_pclmul_copy_crc_u32(const uint8_t *src, uint8_t *dst, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial);
+
+uint32_t dml_avx512_copy_crc_u32(const uint8_t *src, uint8_t *dst, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial);
+
+uint32_t dml_ref_copy_crc_reflected_u32(const uint8_t *src, uint8_t *dst, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial);
+
+uint32_t dml_pclmul_copy_crc_reflected_u32(const uint8_t *src, uint8_t *dst, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial);
+
+uint32_t dml_avx512_copy_crc_reflected_u32(const uint8_t *src, uint8_t *dst, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial);
+
+/** The T10 DIF polynomial 0x8BB7 times x^16, the upper half of a CRC with it is the 16-bit CRC */
+#define DML_CRC16_T10_POLYNOMIAL 0x8BB70000u
+
+void dml_ref_crc16_t10_blocks(const uint8_t *src, uint32_t block_size, uint32_t stride, uint32_t block_count, uint16_t crc_seed, uint16_t *crcs);
+
+void dml_pclmul_crc16_t10_blocks(const uint8_t *src, uint32_t block_size, uint32_t stride, uint32_t block_count, uint16_t crc_seed, uint16_t *crcs);
+
+void dml_avx512_crc16_t10_blocks(const uint8_t *src, uint32_t block_size, uint32_t stride, uint32_t block_count, uint16_t crc_seed, uint16_t *crcs);
+
+void dml_ref_copy_crc16_t10_blocks(const uint8_t *src,
+                                   uint32_t       src_stride,
+                                   uint8_t       *dst,
+                                   uint32_t       dst_stride,
+                                   uint32_t       block_size,
+                                   uint32_t       block_count,
+                                   uint16_t       crc_seed,
+                                   uint16_t      *crcs);
+
+void dml_pclmul_copy_crc16_t10_blocks(const uint8_t *src,
+                                      uint32_t       src_stride,
+                                      uint8_t       *dst,
+                                      uint32_t       dst_stride,
+                                      uint32_t       block_size,
+                                      uint32_t       block_count,
+                                      uint16_t       crc_seed,
+                                      uint16_t      *crcs);
+
+void dml_avx512_copy_crc16_t10_blocks(const uint8_t *src,
+                                      uint32_t       src_stride,
+                                      uint8_t       *dst,
+                                      uint32_t       dst_stride,
+                                      uint32_t       block_size,
+                                      uint32_t       block_count,
+                                      uint16_t       crc_seed,
+                                      uint16_t      *crcs);
+
+void dml_ref_crc_multi_u32(const uint8_t *const *srcs, const uint32_t *sizes, uint32_t count, uint32_t *crcs, uint32_t polynomial);
+
+void dml_pclmul_crc_multi_u32(const uint8_t *const *srcs, const uint32_t *sizes, uint32_t count, uint32_t *crcs, uint32_t polynomial);
+
+void dml_avx512_crc_multi_u32(const uint8_t *const *srcs, const uint32_t *sizes, uint32_t count, uint32_t *crcs, uint32_t polynomial);
+
+void dml_ref_crc_multi_reflected_u32(const uint8_t *const *srcs, const uint32_t *sizes, uint32_t count, uint32_t *crcs, uint32_t polynomial);
+
+void dml_pclmul_crc_multi_reflected_u32(const uint8_t *const *srcs, const uint32_t *sizes, uint32_t count, uint32_t *crcs, uint32_t polynomial);
+
+void dml_avx512_crc_multi_reflected_u32(const uint8_t *const *srcs, const uint32_t *sizes, uint32_t count, uint32_t *crcs, uint32_t polynomial);
+
+uint32_t dml_ref_crc_shift_32u(uint32_t crc_value, uint64_t byte_count, uint32_t polynomial);
 
 void dml_clflushopt(uint8_t *dst, uint32_t transfer_size);
 
@@ -61,6 +157,20 @@ void dml_wait_busy_poll(const volatile uint8_t* pointer);
 
 void dml_wait_umwait(const volatile uint8_t* pointer);
 
+/**
+ * @brief Spins, then sleeps until the expected completion time, then yields. Returns the number of TSC cycles waited
+ */
+uint64_t dml_wait_adaptive(const volatile uint8_t* pointer, uint64_t expected_cycles);
+
+uint64_t dml_wait_adaptive_umwait(const volatile uint8_t* pointer, uint64_t expected_cycles);
+
+/**
+ * @brief Waits until the byte is written or the given number of TSC cycles pass
+ */
+void dml_wait_timed(const volatile uint8_t* pointer, uint64_t cycles);
+
+void dml_wait_timed_umwait(const volatile uint8_t* pointer, uint64_t cycles);
+
 #ifdef __cplusplus
 }
 #endif
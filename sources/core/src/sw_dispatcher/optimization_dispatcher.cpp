@@ -6,6 +6,8 @@
 
 #include "optimization_dispatcher.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <tuple>
 
 #include "dml_cpuid.h"
@@ -13,19 +15,31 @@
 
 namespace dml::core::dispatch
 {
-    static auto gs_mem_move          = dml_ref_mem_move;
-    static auto gs_fill_u64          = dml_ref_fill_u64;
-    static auto gs_compare           = dml_ref_compare;
-    static auto gs_compare_pattern   = dml_ref_compare_pattern;
-    static auto gs_create_delta      = dml_ref_create_delta;
-    static auto gs_apply_delta       = dml_ref_apply_delta;
-    static auto gs_dualcast          = dml_ref_dualcast;
-    static auto gs_crc_u32           = dml_ref_crc_32u;
-    static auto gs_crc_reflected_u32 = dml_ref_crc_reflected_u32;
-    static auto gs_cache_flush       = dml_clflush;
-    static auto gs_cache_write_back  = dml_clwb_unsupported;
-    static auto gs_wait_busy_poll    = dml_wait_busy_poll;
-    static auto gs_wait_umwait       = dml_wait_busy_poll;
+    static auto gs_mem_move                = dml_ref_mem_move;
+    static auto gs_mem_move_nt             = dml_ref_mem_move;
+    static auto gs_fill_u64                = dml_ref_fill_u64;
+    static auto gs_fill_u64_nt             = dml_ref_fill_u64;
+    static auto gs_compare                 = dml_ref_compare;
+    static auto gs_compare_pattern         = dml_ref_compare_pattern;
+    static auto gs_create_delta            = dml_ref_create_delta;
+    static auto gs_apply_delta             = dml_ref_apply_delta;
+    static auto gs_dualcast                = dml_ref_dualcast;
+    static auto gs_dualcast_nt             = dml_ref_dualcast;
+    static auto gs_crc_u32                 = dml_ref_crc_32u;
+    static auto gs_crc_reflected_u32       = dml_ref_crc_reflected_u32;
+    static auto gs_crc_shift_u32           = dml_ref_crc_shift_32u;
+    static auto gs_copy_crc_u32            = dml_ref_copy_crc_u32;
+    static auto gs_copy_crc_reflected_u32  = dml_ref_copy_crc_reflected_u32;
+    static auto gs_crc16_t10_blocks        = dml_ref_crc16_t10_blocks;
+    static auto gs_copy_crc16_t10_blocks   = dml_ref_copy_crc16_t10_blocks;
+    static auto gs_crc_multi_u32           = dml_ref_crc_multi_u32;
+    static auto gs_crc_multi_reflected_u32 = dml_ref_crc_multi_reflected_u32;
+    static auto gs_cache_flush             = dml_clflush;
+    static auto gs_cache_write_back        = dml_clwb_unsupported;
+    static auto gs_wait_busy_poll          = dml_wait_busy_poll;
+    static auto gs_wait_umwait             = dml_wait_busy_poll;
+    static auto gs_wait_adaptive           = dml_wait_adaptive;
+    static auto gs_wait_timed              = dml_wait_timed;
 
     class dispatcher
     {
@@ -33,16 +47,56 @@ namespace dml::core::dispatch
         dispatcher() noexcept
         {
 
+            auto features  = dml_core_cpuid(DML_CPUID_FEATURES);
             auto registers = dml_core_cpuid(DML_CPUID_EXTENSIONS);
 
+            if ((features.ecx & (DML_SSE42 | DML_PCLMULQDQ)) == (DML_SSE42 | DML_PCLMULQDQ))
+            {
+                gs_crc_u32                 = dml_pclmul_crc_u32;
+                gs_crc_reflected_u32       = dml_pclmul_crc_reflected_u32;
+                gs_copy_crc_u32            = dml_pclmul_copy_crc_u32;
+                gs_copy_crc_reflected_u32  = dml_pclmul_copy_crc_reflected_u32;
+                gs_crc16_t10_blocks        = dml_pclmul_crc16_t10_blocks;
+                gs_copy_crc16_t10_blocks   = dml_pclmul_copy_crc16_t10_blocks;
+                gs_crc_multi_u32           = dml_pclmul_crc_multi_u32;
+                gs_crc_multi_reflected_u32 = dml_pclmul_crc_multi_reflected_u32;
+            }
+
+            if ((registers.ebx & DML_AVX2) == DML_AVX2)
+            {
+                gs_mem_move        = dml_avx2_mem_move;
+                gs_mem_move_nt     = dml_avx2_mem_move;
+                gs_fill_u64        = dml_avx2_fill_u64;
+                gs_fill_u64_nt     = dml_avx2_fill_u64;
+                gs_compare         = dml_avx2_compare;
+                gs_compare_pattern = dml_avx2_compare_pattern;
+                gs_create_delta    = dml_avx2_create_delta;
+                gs_dualcast        = dml_avx2_dualcast;
+                gs_dualcast_nt     = dml_avx2_dualcast;
+            }
+
             if ((registers.ebx & DML_AVX512_MASK) == DML_AVX512_MASK)
             {
                 gs_mem_move        = dml_avx512_mem_move;
+                gs_mem_move_nt     = dml_avx512_mem_move_nt;
                 gs_fill_u64        = dml_avx512_fill_u64;
+                gs_fill_u64_nt     = dml_avx512_fill_u64_nt;
                 gs_compare         = dml_avx512_compare;
                 gs_compare_pattern = dml_avx512_compare_pattern;
-                gs_crc_u32         = dml_avx512_crc_u32;
-                gs_crc_reflected_u32 = dml_avx512_crc_reflected_u32;
+                gs_create_delta    = dml_avx512_create_delta;
+                gs_apply_delta     = dml_avx512_apply_delta;
+                gs_dualcast        = dml_avx512_dualcast;
+                gs_dualcast_nt     = dml_avx512_dualcast_nt;
+
+                if ((registers.ecx & DML_VPCLMULQDQ) == DML_VPCLMULQDQ)
+                {
+                    gs_copy_crc_u32            = dml_avx512_copy_crc_u32;
+                    gs_copy_crc_reflected_u32  = dml_avx512_copy_crc_reflected_u32;
+                    gs_crc16_t10_blocks        = dml_avx512_crc16_t10_blocks;
+                    gs_copy_crc16_t10_blocks   = dml_avx512_copy_crc16_t10_blocks;
+                    gs_crc_multi_u32           = dml_avx512_crc_multi_u32;
+                    gs_crc_multi_reflected_u32 = dml_avx512_crc_multi_reflected_u32;
+                }
             }
 
             if ((registers.ebx & DML_CLFLUSHOPT) == DML_CLFLUSHOPT)
@@ -57,23 +111,56 @@ namespace dml::core::dispatch
 
             if ((registers.ecx & DML_WAITPKG) == DML_WAITPKG)
             {
-                gs_wait_umwait = dml_wait_umwait;
+                gs_wait_umwait   = dml_wait_umwait;
+                gs_wait_adaptive = dml_wait_adaptive_umwait;
+                gs_wait_timed    = dml_wait_timed_umwait;
             }
         }
     };
 
     [[maybe_unused]] static auto gs_dispatcher = dispatcher();
 
+    bool is_non_temporal(uint32_t transfer_size, bool cache_control) noexcept
+    {
+        // Used if the cache size is unknown
+        constexpr uint32_t default_threshold = 1024u * 1024u;
+
+        if (transfer_size < min_non_temporal_size)
+        {
+            return false;
+        }
+
+        if (!cache_control)
+        {
+            return true;
+        }
+
+        // A result taking more than half of the last level cache would be evicted before it is read anyway
+        const auto cache_size = dml_core_get_cache_size();
+
+        return (cache_size > 0u) ? (transfer_size > cache_size / 2u) : (transfer_size >= default_threshold);
+    }
+
     void mem_move(const uint8_t* src, uint8_t* dst, uint32_t transfer_size) noexcept
     {
         gs_mem_move(src, dst, transfer_size);
     }
 
+    void mem_move_non_temporal(const uint8_t* src, uint8_t* dst, uint32_t transfer_size) noexcept
+    {
+        gs_mem_move_nt(src, dst, transfer_size);
+    }
+
     void fill(uint64_t pattern, uint8_t* dst, uint32_t transfer_size) noexcept
     {
         gs_fill_u64(pattern, dst, transfer_size);
     }
 
+    void fill_non_temporal(uint64_t pattern, uint8_t* dst, uint32_t transfer_size) noexcept
+    {
+        gs_fill_u64_nt(pattern, dst, transfer_size);
+    }
+
     std::tuple<uint32_t, uint8_t> compare(const uint8_t* src1, const uint8_t* src2, uint32_t transfer_size) noexcept
     {
         uint8_t result   = 0;
@@ -112,6 +199,11 @@ namespace dml::core::dispatch
         gs_dualcast(src, dst1, dst2, transfer_size);
     }
 
+    void dualcast_non_temporal(const uint8_t* src, uint8_t* dst1, uint8_t* dst2, uint32_t transfer_size) noexcept
+    {
+        gs_dualcast_nt(src, dst1, dst2, transfer_size);
+    }
+
     uint32_t crc(const uint8_t* src, uint32_t transfer_size, uint32_t crc_seed, uint32_t polynomial) noexcept
     {
         return gs_crc_u32(src, transfer_size, crc_seed, polynomial);
@@ -122,6 +214,48 @@ namespace dml::core::dispatch
         return gs_crc_reflected_u32(src, transfer_size, crc_seed, polynomial);
     }
 
+    uint32_t copy_crc(const uint8_t* src, uint8_t* dst, uint32_t transfer_size, uint32_t crc_seed, uint32_t polynomial) noexcept
+    {
+        return gs_copy_crc_u32(src, dst, transfer_size, crc_seed, polynomial);
+    }
+
+    uint32_t copy_crc_reflected(const uint8_t* src, uint8_t* dst, uint32_t transfer_size, uint32_t crc_seed, uint32_t polynomial) noexcept
+    {
+        return gs_copy_crc_reflected_u32(src, dst, transfer_size, crc_seed, polynomial);
+    }
+
+    void crc_multi(const uint8_t* const* srcs, const uint32_t* sizes, uint32_t count, uint32_t* crcs, uint32_t polynomial) noexcept
+    {
+        gs_crc_multi_u32(srcs, sizes, count, crcs, polynomial);
+    }
+
+    void crc_multi_reflected(const uint8_t* const* srcs, const uint32_t* sizes, uint32_t count, uint32_t* crcs, uint32_t polynomial) noexcept
+    {
+        gs_crc_multi_reflected_u32(srcs, sizes, count, crcs, polynomial);
+    }
+
+    void crc16_t10(const uint8_t* src, uint32_t block_size, uint32_t stride, uint32_t block_count, uint16_t crc_seed, uint16_t* crcs) noexcept
+    {
+        gs_crc16_t10_blocks(src, block_size, stride, block_count, crc_seed, crcs);
+    }
+
+    void copy_crc16_t10(const uint8_t* src,
+                        uint32_t       src_stride,
+                        uint8_t*       dst,
+                        uint32_t       dst_stride,
+                        uint32_t       block_size,
+                        uint32_t       block_count,
+                        uint16_t       crc_seed,
+                        uint16_t*      crcs) noexcept
+    {
+        gs_copy_crc16_t10_blocks(src, src_stride, dst, dst_stride, block_size, block_count, crc_seed, crcs);
+    }
+
+    uint32_t crc_shift(uint32_t crc_value, uint64_t byte_count, uint32_t polynomial) noexcept
+    {
+        return gs_crc_shift_u32(crc_value, byte_count, polynomial);
+    }
+
     void cache_flush(uint8_t* dst, uint32_t transfer_size) noexcept
     {
         gs_cache_flush(dst, transfer_size);
@@ -142,4 +276,32 @@ namespace dml::core::dispatch
         gs_wait_umwait(pointer);
     }
 
+    void wait_adaptive(const volatile uint8_t* pointer, uint32_t transfer_size, wait_estimate& estimate) noexcept
+    {
+        // Round trip of a descriptor through the device, operations without data take about that long
+        constexpr uint64_t min_expected_cycles = 8192u;
+
+        // Below that the round trip dominates, so the time says little about throughput
+        constexpr uint32_t min_calibration_size = 64u * 1024u;
+
+        const auto cycles_per_kb   = estimate.cycles_per_kb.load(std::memory_order_relaxed);
+        const auto expected_cycles = std::max(min_expected_cycles, (uint64_t(transfer_size) * cycles_per_kb) >> 10u);
+        const auto elapsed_cycles  = gs_wait_adaptive(pointer, expected_cycles);
+
+        // A wait that started late is shorter than the transfer, so only waits that took a while are counted,
+        // and their weight is 1/8 to smooth out the noise
+        if (transfer_size >= min_calibration_size && elapsed_cycles > min_expected_cycles)
+        {
+            const auto sample  = static_cast<uint32_t>(std::min<uint64_t>((elapsed_cycles << 10u) / transfer_size, UINT32_MAX));
+            const auto updated = cycles_per_kb - cycles_per_kb / 8u + sample / 8u;
+
+            estimate.cycles_per_kb.store(std::max(updated, 1u), std::memory_order_relaxed);
+        }
+    }
+
+    void wait_timed(const volatile uint8_t* pointer, uint64_t cycles) noexcept
+    {
+        gs_wait_timed(pointer, cycles);
+    }
+
 }  // namespace dml::core::dispatch
@@ -7,15 +7,31 @@
 #ifndef DML_CORE_OWN_KERNELS_OPTIMIZATION_DISPATCHER_HPP
 #define DML_CORE_OWN_KERNELS_OPTIMIZATION_DISPATCHER_HPP
 
+#include <atomic>
 #include <cstdint>
 #include <tuple>
 
 namespace dml::core::dispatch
 {
+    /**
+     * @brief Smallest result written with streaming stores, less than a page is cheap to keep in the cache
+     */
+    constexpr uint32_t min_non_temporal_size = 4096u;
+
+    /**
+     * @brief Returns whether a result of transfer_size bytes should be written with streaming stores,
+     *        cache_control is the destination cache fill flag of the descriptor
+     */
+    bool is_non_temporal(uint32_t transfer_size, bool cache_control) noexcept;
+
     void mem_move(const uint8_t* src, uint8_t* dst, uint32_t transfer_size) noexcept;
 
+    void mem_move_non_temporal(const uint8_t* src, uint8_t* dst, uint32_t transfer_size) noexcept;
+
     void fill(uint64_t pattern, uint8_t* dst, uint32_t transfer_size) noexcept;
 
+    void fill_non_temporal(uint64_t pattern, uint8_t* dst, uint32_t transfer_size) noexcept;
+
     std::tuple<uint32_t, uint8_t> compare(const uint8_t* src1, const uint8_t* src2, uint32_t transfer_size) noexcept;
 
     std::tuple<uint32_t, uint8_t> compare_pattern(uint64_t pattern, const uint8_t* src, uint32_t transfer_size) noexcept;
@@ -30,10 +46,56 @@ namespace dml::core::dispatch
 
     void dualcast(const uint8_t* src, uint8_t* dst1, uint8_t* dst2, uint32_t transfer_size) noexcept;
 
+    void dualcast_non_temporal(const uint8_t* src, uint8_t* dst1, uint8_t* dst2, uint32_t transfer_size) noexcept;
+
     uint32_t crc(const uint8_t* src, uint32_t transfer_size, uint32_t crc_seed, uint32_t polynomial = 0x1EDC6F41u) noexcept;
 
     uint32_t crc_reflected(const uint8_t* src, uint32_t transfer_size, uint32_t crc_seed, uint32_t polynomial = 0x1EDC6F41u) noexcept;
 
+    /**
+     * @brief Copies the data and returns its CRC, both are done in one pass over the source
+     */
+    uint32_t copy_crc(const uint8_t* src, uint8_t* dst, uint32_t transfer_size, uint32_t crc_seed, uint32_t polynomial = 0x1EDC6F41u) noexcept;
+
+    uint32_t copy_crc_reflected(const uint8_t* src,
+                                uint8_t*       dst,
+                                uint32_t       transfer_size,
+                                uint32_t       crc_seed,
+                                uint32_t       polynomial = 0x1EDC6F41u) noexcept;
+
+    /**
+     * @brief Replaces the seed in crcs[i] with the CRC of srcs[i], independent buffers are hashed in parallel
+     */
+    void crc_multi(const uint8_t* const* srcs, const uint32_t* sizes, uint32_t count, uint32_t* crcs, uint32_t polynomial = 0x1EDC6F41u) noexcept;
+
+    void crc_multi_reflected(const uint8_t* const* srcs,
+                             const uint32_t*       sizes,
+                             uint32_t              count,
+                             uint32_t*             crcs,
+                             uint32_t              polynomial = 0x1EDC6F41u) noexcept;
+
+    /**
+     * @brief Writes T10 DIF CRC of block_count blocks of block_size bytes each, blocks start stride bytes apart
+     */
+    void crc16_t10(const uint8_t* src, uint32_t block_size, uint32_t stride, uint32_t block_count, uint16_t crc_seed, uint16_t* crcs) noexcept;
+
+    /**
+     * @brief Same as @ref crc16_t10, but also copies every block to the destination in the same pass
+     */
+    void copy_crc16_t10(const uint8_t* src,
+                        uint32_t       src_stride,
+                        uint8_t*       dst,
+                        uint32_t       dst_stride,
+                        uint32_t       block_size,
+                        uint32_t       block_count,
+                        uint16_t       crc_seed,
+                        uint16_t*      crcs) noexcept;
+
+    /**
+     * @brief Returns CRC of the data the crc_value was calculated for, followed by byte_count zero bytes
+     */
+    uint32_t crc_shift(uint32_t crc_value, uint64_t byte_count, uint32_t polynomial = 0x1EDC6F41u) noexcept;
+
     void cache_flush(uint8_t* dst, uint32_t transfer_size) noexcept;
 
     void cache_write_back(uint8_t* dst, uint32_t transfer_size) noexcept;
@@ -41,6 +103,26 @@ namespace dml::core::dispatch
     void wait_busy_poll(const volatile uint8_t* pointer) noexcept;
 
     void wait_umwait(const volatile uint8_t* pointer) noexcept;
+
+    /**
+     * @brief TSC cycles a KiB of transfer takes on one executor, starts at about 30 GB/s with a 2 GHz TSC
+     */
+    struct wait_estimate
+    {
+        std::atomic<uint32_t> cycles_per_kb{64u};
+    };
+
+    /**
+     * @brief Waits for the byte to be written with the time a transfer of this size is expected to take as a hint
+     *
+     * The expected time is learned from previous waits for large transfers on the same executor
+     */
+    void wait_adaptive(const volatile uint8_t* pointer, uint32_t transfer_size, wait_estimate& estimate) noexcept;
+
+    /**
+     * @brief Waits until the byte is written or the given number of TSC cycles pass, whichever comes first
+     */
+    void wait_timed(const volatile uint8_t* pointer, uint64_t cycles) noexcept;
 }  // namespace dml::core::dispatch
 
 #endif  //DML_CORE_OWN_KERNELS_OPTIMIZATION_DISPATCHER_HPP
@@ -0,0 +1,146 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <string.h>
+
+#include "../dml_kernels.h"
+
+#if defined(_MSC_BUILD)
+#include <intrin.h>
+#elif defined(__GNUC__)
+#include <x86intrin.h>
+#else
+#error "Unsupported compiler"
+#endif
+
+/** Shorter buffers are copied first and then hashed by the regular kernel */
+#define OWN_FOLDING_MIN_SIZE 256u
+
+/** x^512 and x^576 modulo the default polynomial, other polynomials get them computed */
+#define OWN_DEFAULT_POLYNOMIAL 0x1EDC6F41u
+#define OWN_DEFAULT_X512       0xAA97D41Du
+#define OWN_DEFAULT_X576       0xA6955F31u
+
+/** The same for DML_CRC16_T10_POLYNOMIAL, used to copy DIF blocks */
+#define OWN_T10_X512       0x87E70000u
+#define OWN_T10_X576       0x371D0000u
+
+/**
+ * @brief Reverses the bit order of every byte
+ */
+static inline __m128i own_reflect_bytes(__m128i data)
+{
+    const __m128i low_nibbles  =
+        _mm_setr_epi8(0x00, (char)0x80, 0x40, (char)0xC0, 0x20, (char)0xA0, 0x60, (char)0xE0, 0x10, (char)0x90, 0x50, (char)0xD0, 0x30, (char)0xB0, 0x70, (char)0xF0);
+    const __m128i high_nibbles =
+        _mm_setr_epi8(0x00, 0x08, 0x04, 0x0C, 0x02, 0x0A, 0x06, 0x0E, 0x01, 0x09, 0x05, 0x0D, 0x03, 0x0B, 0x07, 0x0F);
+    const __m128i nibble_mask  = _mm_set1_epi8(0x0F);
+
+    return _mm_or_si128(_mm_shuffle_epi8(low_nibbles, _mm_and_si128(data, nibble_mask)),
+                        _mm_shuffle_epi8(high_nibbles, _mm_and_si128(_mm_srli_epi16(data, 4), nibble_mask)));
+}
+
+/**
+ * @brief Turns 16 bytes into a polynomial with the first bit of the first byte as the highest coefficient
+ */
+static inline __m128i own_to_polynomial(__m128i data, bool reflect_data)
+{
+    const __m128i byte_order = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+
+    return _mm_shuffle_epi8(reflect_data ? own_reflect_bytes(data) : data, byte_order);
+}
+
+/**
+ * @brief Returns a polynomial congruent to accumulator * x^512 + data, high qword of constants is x^576, low one is x^512
+ */
+static inline __m128i own_fold_128(__m128i accumulator, __m128i constants, __m128i data)
+{
+    const __m128i high = _mm_clmulepi64_si128(accumulator, constants, 0x11);
+    const __m128i low  = _mm_clmulepi64_si128(accumulator, constants, 0x00);
+
+    return _mm_xor_si128(_mm_xor_si128(high, low), data);
+}
+
+static inline __m128i own_fold_constants(uint32_t polynomial)
+{
+    if (OWN_DEFAULT_POLYNOMIAL == polynomial)
+    {
+        return _mm_set_epi64x(OWN_DEFAULT_X576, OWN_DEFAULT_X512);
+    }
+
+    if (DML_CRC16_T10_POLYNOMIAL == polynomial)
+    {
+        return _mm_set_epi64x(OWN_T10_X576, OWN_T10_X512);
+    }
+
+    return _mm_set_epi64x((long long)dml_ref_crc_shift_32u(1u, 72u, polynomial), (long long)dml_ref_crc_shift_32u(1u, 64u, polynomial));
+}
+
+/*
+ * Each 64-byte line is stored to the destination and folded into four accumulators while it is in registers.
+ * The seed is added to the highest 32 bits of the message, the folded remainder is a 64-byte message with
+ * the same CRC, and it is hashed by the regular kernel along with the tail
+ */
+static inline uint32_t own_copy_crc_32u(const uint8_t *src, uint8_t *dst, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial, bool reflect_data)
+{
+    uint32_t (*const crc_kernel)(const uint8_t *, uint32_t, uint32_t, uint32_t) =
+        reflect_data ? dml_pclmul_crc_reflected_u32 : dml_pclmul_crc_u32;
+
+    uint32_t i = 0u;
+
+    if (transfer_size >= OWN_FOLDING_MIN_SIZE)
+    {
+        const __m128i byte_order = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+        const __m128i constants  = own_fold_constants(polynomial);
+
+        __m128i xmm[4];
+
+        for (uint32_t lane = 0u; lane < 4u; ++lane)
+        {
+            const __m128i data = _mm_loadu_si128((const __m128i *)(src + lane * 16u));
+
+            _mm_storeu_si128((__m128i *)(dst + lane * 16u), data);
+            xmm[lane] = own_to_polynomial(data, reflect_data);
+        }
+
+        xmm[0] = _mm_xor_si128(xmm[0], _mm_set_epi32((int)crc_value, 0, 0, 0));
+
+        for (i = 64u; (i + 64u) <= transfer_size; i += 64u)
+        {
+            for (uint32_t lane = 0u; lane < 4u; ++lane)
+            {
+                const __m128i data = _mm_loadu_si128((const __m128i *)(src + i + lane * 16u));
+
+                _mm_storeu_si128((__m128i *)(dst + i + lane * 16u), data);
+                xmm[lane] = own_fold_128(xmm[lane], constants, own_to_polynomial(data, reflect_data));
+            }
+        }
+
+        uint8_t remainder[64];
+
+        for (uint32_t lane = 0u; lane < 4u; ++lane)
+        {
+            _mm_storeu_si128((__m128i *)(remainder + lane * 16u), _mm_shuffle_epi8(xmm[lane], byte_order));
+        }
+
+        // The remainder already has the data bits in polynomial order
+        crc_value = dml_pclmul_crc_u32(remainder, sizeof(remainder), 0u, polynomial);
+    }
+
+    memcpy(dst + i, src + i, transfer_size - i);
+
+    return crc_kernel(src + i, transfer_size - i, crc_value, polynomial);
+}
+
+uint32_t dml_pclmul_copy_crc_u32(const uint8_t *src, uint8_t *dst, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial)
+{
+    return own_copy_crc_32u(src, dst, transfer_size, crc_value, polynomial, false);
+}
+
+uint32_t dml_pclmul_copy_crc_reflected_u32(const uint8_t *src, uint8_t *dst, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial)
+{
+    return own_copy_crc_32u(src, dst, transfer_size, crc_value, polynomial, true);
+}
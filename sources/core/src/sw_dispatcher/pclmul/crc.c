@@ -5,8 +5,12 @@
 
  ******************************************************************************/
 
+#include "../crc_cache.h"
 #include "../dml_kernels.h"
 
+#include <stdlib.h>
+#include <string.h>
+
 #if defined(_MSC_BUILD)
 #include <intrin.h>
 #elif defined(__GNUC__)
@@ -36,11 +40,24 @@ static const uint8_t opt_poly_1_ptr[128] = {
 */
 static inline uint32_t getCRCSize(uint64_t poly)
 {
-    uint32_t crcSize;
-    crcSize = 63 - (uint32_t)_lzcnt_u64(poly);
+    uint32_t crcSize = 63;
+    while (crcSize != 0 && !(poly & ((uint64_t)1 << crcSize)))
+    {
+        crcSize--;
+    }
     return crcSize;
 }
 
+/**
+ * @brief Loads the first length bytes (less than 16) and zeroes the rest, without reading past the buffer
+ */
+static inline __m128i own_load_partial_128(const uint8_t* src_ptr, uint32_t length)
+{
+    uint8_t buffer[16] = { 0 };
+    memcpy(buffer, src_ptr, length);
+    return _mm_loadu_si128((const __m128i*)buffer);
+}
+
 /**
 *  @todo
 */
@@ -170,21 +187,61 @@ static inline void own_gen_crc_opt_poly_8u(uint64_t poly, uint8_t optPoly[128])
     }
 }
 
+#define OWN_OPT_POLY_CACHE_SIZE 16u
+
+typedef struct
+{
+    own_crc_cache_entry_t header;
+    uint8_t               opt_poly[128];
+} own_crc_opt_poly_t;
+
+// Folding constants are generated once per polynomial
+static own_crc_cache_entry_t *volatile own_opt_poly_cache[OWN_OPT_POLY_CACHE_SIZE];
+
+static own_crc_cache_entry_t* own_build_crc_opt_poly(uint32_t polynomial)
+{
+    own_crc_opt_poly_t* entry = (own_crc_opt_poly_t*)calloc(1u, sizeof(own_crc_opt_poly_t));
+
+    if (NULL == entry) {
+        return NULL;
+    }
+
+    entry->header.polynomial = polynomial;
+    own_gen_crc_opt_poly_8u((uint64_t)polynomial | ((uint64_t)1u << (uint64_t)32u), entry->opt_poly);
+
+    return &entry->header;
+}
+
+/**
+ * @brief Returns folding constants of the polynomial, they are generated into local_opt_poly if the cache is full
+ */
+static const uint8_t* own_get_crc_opt_poly(uint32_t polynomial, uint8_t local_opt_poly[128])
+{
+    if (D_POLYNOMIAL_1 == polynomial) {
+        return opt_poly_1_ptr;
+    }
+
+    const own_crc_opt_poly_t* entry =
+        (const own_crc_opt_poly_t*)own_crc_cache_get(own_opt_poly_cache, OWN_OPT_POLY_CACHE_SIZE, polynomial, own_build_crc_opt_poly);
+
+    if (NULL != entry) {
+        return entry->opt_poly;
+    }
+
+    own_gen_crc_opt_poly_8u((uint64_t)polynomial | ((uint64_t)1u << (uint64_t)32u), local_opt_poly);
+
+    return local_opt_poly;
+}
+
 static inline void dmlc_own_calculate_crc_32u(const uint8_t* const memory_region_ptr,
     uint32_t             bytes_to_hash,
     uint32_t* const      crc_ptr,
     uint32_t             polynomial)
 {
     uint64_t    poly = (uint64_t)polynomial | ((uint64_t)1u << (uint64_t)32u);
+    uint8_t     local_opt_poly[128];
 
-    if (D_POLYNOMIAL_1 == polynomial) {
-        own_CRC_8u_k0(memory_region_ptr, bytes_to_hash, poly, opt_poly_1_ptr, *crc_ptr, crc_ptr);
-    }
-    else {
-        uint8_t opt_poly_ptr[128];
-        own_gen_crc_opt_poly_8u(poly, opt_poly_ptr);
-        own_CRC_8u_k0(memory_region_ptr, bytes_to_hash, poly, opt_poly_ptr, *crc_ptr, crc_ptr);
-    }
+    own_CRC_8u_k0(memory_region_ptr, bytes_to_hash, poly, own_get_crc_opt_poly(polynomial, local_opt_poly), *crc_ptr, crc_ptr);
 }
 
 static inline void dmlc_own_calculate_crc_reflected_32u(const uint8_t* const memory_region_ptr,
@@ -193,15 +250,9 @@ static inline void dmlc_own_calculate_crc_reflected_32u(const uint8_t* const mem
     uint32_t             polynomial)
 {
     uint64_t    poly = (uint64_t)polynomial | ((uint64_t)1u << (uint64_t)32u);
+    uint8_t     local_opt_poly[128];
 
-    if (D_POLYNOMIAL_1 == polynomial) {
-        own_CRC_reflected_8u_k0(memory_region_ptr, bytes_to_hash, poly, opt_poly_1_ptr, *crc_ptr, crc_ptr);
-    }
-    else {
-        uint8_t opt_poly_ptr[128];
-        own_gen_crc_opt_poly_8u(poly, opt_poly_ptr);
-        own_CRC_reflected_8u_k0(memory_region_ptr, bytes_to_hash, poly, opt_poly_ptr, *crc_ptr, crc_ptr);
-    }
+    own_CRC_reflected_8u_k0(memory_region_ptr, bytes_to_hash, poly, own_get_crc_opt_poly(polynomial, local_opt_poly), *crc_ptr, crc_ptr);
 }
 
 #if defined(_MSC_VER)
@@ -1356,9 +1407,7 @@ static uint64_t own_crc32_long_le_k0(const uint8_t* src_ptr, uint32_t length, ui
         }
 
         if (tail) {
-            __mmask16 tail_mask = (1 << tail) - 1;
-
-            xmm2 = _mm_maskz_loadu_epi8(tail_mask, (__m128i*)src_ptr);
+            xmm2 = own_load_partial_128(src_ptr, tail);
             xmm2 = _mm_shuffle_epi8(xmm2, shuffle_le_mask);
 
             own_shift_two_lanes(tail, &xmm2, &xmm0);
@@ -1616,9 +1665,7 @@ uint32_t own_crc32_long_be_k0(const uint8_t* src_ptr, uint32_t length, uint32_t
         }
 
         if (tail) {
-            __mmask16 tail_mask = (1 << tail) - 1;
-
-            xmm2 = _mm_maskz_loadu_epi8(tail_mask, (__m128i*)src_ptr);
+            xmm2 = own_load_partial_128(src_ptr, tail);
 
             own_shift_two_lanes_be(tail, &xmm2, &xmm0);
 
@@ -1687,13 +1734,13 @@ uint32_t own_crc32_long_be_k0(const uint8_t* src_ptr, uint32_t length, uint32_t
 /*********************************/
 
 
-uint32_t dml_avx512_crc_u32(const uint8_t* src, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial)
+uint32_t dml_pclmul_crc_u32(const uint8_t* src, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial)
 {
     dmlc_own_calculate_crc_32u(src, transfer_size, &crc_value, polynomial);
     return crc_value;
 }
 
-uint32_t dml_avx512_crc_reflected_u32(const uint8_t* src, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial)
+uint32_t dml_pclmul_crc_reflected_u32(const uint8_t* src, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial)
 {
     dmlc_own_calculate_crc_reflected_32u(src, transfer_size, &crc_value, polynomial);
     return crc_value;
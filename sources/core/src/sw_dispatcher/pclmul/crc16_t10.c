@@ -0,0 +1,40 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <stddef.h>
+
+#include "../dml_kernels.h"
+
+void dml_pclmul_crc16_t10_blocks(const uint8_t *src, uint32_t block_size, uint32_t stride, uint32_t block_count, uint16_t crc_seed, uint16_t *crcs)
+{
+    for (uint32_t block = 0u; block < block_count; ++block)
+    {
+        const uint32_t crc = dml_pclmul_crc_u32(src + (size_t)block * stride, block_size, (uint32_t)crc_seed << 16u, DML_CRC16_T10_POLYNOMIAL);
+
+        crcs[block] = (uint16_t)(crc >> 16u);
+    }
+}
+
+void dml_pclmul_copy_crc16_t10_blocks(const uint8_t *src,
+                                      uint32_t       src_stride,
+                                      uint8_t       *dst,
+                                      uint32_t       dst_stride,
+                                      uint32_t       block_size,
+                                      uint32_t       block_count,
+                                      uint16_t       crc_seed,
+                                      uint16_t      *crcs)
+{
+    for (uint32_t block = 0u; block < block_count; ++block)
+    {
+        const uint32_t crc = dml_pclmul_copy_crc_u32(src + (size_t)block * src_stride,
+                                                     dst + (size_t)block * dst_stride,
+                                                     block_size,
+                                                     (uint32_t)crc_seed << 16u,
+                                                     DML_CRC16_T10_POLYNOMIAL);
+
+        crcs[block] = (uint16_t)(crc >> 16u);
+    }
+}
@@ -0,0 +1,23 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "../dml_kernels.h"
+
+void dml_pclmul_crc_multi_u32(const uint8_t *const *srcs, const uint32_t *sizes, uint32_t count, uint32_t *crcs, uint32_t polynomial)
+{
+    for (uint32_t i = 0u; i < count; ++i)
+    {
+        crcs[i] = dml_pclmul_crc_u32(srcs[i], sizes[i], crcs[i], polynomial);
+    }
+}
+
+void dml_pclmul_crc_multi_reflected_u32(const uint8_t *const *srcs, const uint32_t *sizes, uint32_t count, uint32_t *crcs, uint32_t polynomial)
+{
+    for (uint32_t i = 0u; i < count; ++i)
+    {
+        crcs[i] = dml_pclmul_crc_reflected_u32(srcs[i], sizes[i], crcs[i], polynomial);
+    }
+}
@@ -0,0 +1,37 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <string.h>
+
+#include "../dml_kernels.h"
+
+/** Each chunk is hashed right after it is copied, while it is still in L1 */
+#define OWN_CHUNK_SIZE 4096u
+
+static inline uint32_t own_copy_crc_32u(const uint8_t *src, uint8_t *dst, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial, bool reflect_data)
+{
+    for (uint32_t i = 0u; i < transfer_size; i += OWN_CHUNK_SIZE)
+    {
+        const uint32_t chunk_size = (transfer_size - i < OWN_CHUNK_SIZE) ? transfer_size - i : OWN_CHUNK_SIZE;
+
+        memcpy(dst + i, src + i, chunk_size);
+
+        crc_value = reflect_data ? dml_ref_crc_reflected_u32(dst + i, chunk_size, crc_value, polynomial)
+                                 : dml_ref_crc_32u(dst + i, chunk_size, crc_value, polynomial);
+    }
+
+    return crc_value;
+}
+
+uint32_t dml_ref_copy_crc_u32(const uint8_t *src, uint8_t *dst, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial)
+{
+    return own_copy_crc_32u(src, dst, transfer_size, crc_value, polynomial, false);
+}
+
+uint32_t dml_ref_copy_crc_reflected_u32(const uint8_t *src, uint8_t *dst, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial)
+{
+    return own_copy_crc_32u(src, dst, transfer_size, crc_value, polynomial, true);
+}
@@ -5,9 +5,24 @@
  ******************************************************************************/
 
 #include <stddef.h>
+#include <stdlib.h>
 
+#include "../crc_cache.h"
 #include "../dml_kernels.h"
 
+#define OWN_SLICE_COUNT       16u
+#define OWN_TABLE_CACHE_SIZE  8u
+#define OWN_SLICING_MIN_BYTES 64u
+
+typedef struct
+{
+    own_crc_cache_entry_t header;
+    uint32_t              table[OWN_SLICE_COUNT][256];
+} own_crc_tables_t;
+
+// Slicing tables are built once per polynomial
+static own_crc_cache_entry_t *volatile own_tables_cache[OWN_TABLE_CACHE_SIZE];
+
 static inline uint8_t reverse(uint8_t byte)
 {
     byte = ((byte & 0x55u) << 1u) | ((byte & 0xAAu) >> 1u);
@@ -34,22 +49,139 @@ static inline uint32_t calculate_crc_32u(uint32_t crc_value, uint8_t data, uint3
     return crc_value;
 }
 
-uint32_t dml_ref_crc_32u(const uint8_t *src, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial)
+static own_crc_cache_entry_t *own_build_tables(uint32_t polynomial)
+{
+    own_crc_tables_t *tables = (own_crc_tables_t *)malloc(sizeof(own_crc_tables_t));
+
+    if (tables == NULL)
+    {
+        return NULL;
+    }
+
+    tables->header.polynomial = polynomial;
+
+    for (uint32_t byte = 0u; byte < 256u; ++byte)
+    {
+        tables->table[0][byte] = calculate_crc_32u(0u, (uint8_t)byte, polynomial);
+    }
+
+    // table[k][b] is the CRC of byte b followed by k zero bytes
+    for (uint32_t slice = 1u; slice < OWN_SLICE_COUNT; ++slice)
+    {
+        for (uint32_t byte = 0u; byte < 256u; ++byte)
+        {
+            const uint32_t previous = tables->table[slice - 1u][byte];
+
+            tables->table[slice][byte] = (previous << 8u) ^ tables->table[0][previous >> 24u];
+        }
+    }
+
+    return &tables->header;
+}
+
+/**
+ * @brief Returns slicing tables for the polynomial or NULL if the cache is full and no memory is available
+ */
+static const own_crc_tables_t *own_get_tables(uint32_t polynomial)
+{
+    return (const own_crc_tables_t *)own_crc_cache_get(own_tables_cache, OWN_TABLE_CACHE_SIZE, polynomial, own_build_tables);
+}
+
+static inline uint32_t own_crc_slicing_by_16(const own_crc_tables_t *tables,
+                                             const uint8_t          *src,
+                                             size_t                  block_count,
+                                             uint32_t                crc_value,
+                                             bool                    reflect_data)
 {
-    for (size_t byte = 0; byte < transfer_size; ++byte)
+    uint8_t data[OWN_SLICE_COUNT];
+
+    for (size_t block = 0u; block < block_count; ++block, src += OWN_SLICE_COUNT)
     {
-        crc_value = calculate_crc_32u(crc_value, src[byte], polynomial);
+        for (uint32_t i = 0u; i < OWN_SLICE_COUNT; ++i)
+        {
+            data[i] = reflect_data ? reverse(src[i]) : src[i];
+        }
+
+        // The first four bytes absorb the current state, every byte is then shifted past the rest of the block
+        crc_value = tables->table[15][data[0] ^ (uint8_t)(crc_value >> 24u)] ^
+                    tables->table[14][data[1] ^ (uint8_t)(crc_value >> 16u)] ^
+                    tables->table[13][data[2] ^ (uint8_t)(crc_value >> 8u)] ^
+                    tables->table[12][data[3] ^ (uint8_t)crc_value] ^
+                    tables->table[11][data[4]] ^ tables->table[10][data[5]] ^ tables->table[9][data[6]] ^
+                    tables->table[8][data[7]] ^ tables->table[7][data[8]] ^ tables->table[6][data[9]] ^
+                    tables->table[5][data[10]] ^ tables->table[4][data[11]] ^ tables->table[3][data[12]] ^
+                    tables->table[2][data[13]] ^ tables->table[1][data[14]] ^ tables->table[0][data[15]];
     }
 
     return crc_value;
 }
 
-uint32_t dml_ref_crc_reflected_u32(const uint8_t *src, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial)
+static inline uint32_t own_crc_32u(const uint8_t *src, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial, bool reflect_data)
 {
-    for (size_t byte = 0; byte < transfer_size; ++byte)
+    size_t byte = 0u;
+
+    // Short buffers are not worth a table lookup, the tables of a new polynomial cost about 4 KB of bitwise work
+    if (transfer_size >= OWN_SLICING_MIN_BYTES)
+    {
+        const own_crc_tables_t *tables = own_get_tables(polynomial);
+
+        if (tables != NULL)
+        {
+            const size_t block_count = transfer_size / OWN_SLICE_COUNT;
+
+            crc_value = own_crc_slicing_by_16(tables, src, block_count, crc_value, reflect_data);
+            byte      = block_count * OWN_SLICE_COUNT;
+        }
+    }
+
+    for (; byte < transfer_size; ++byte)
     {
-        crc_value = calculate_crc_32u(crc_value, reverse(src[byte]), polynomial);
+        crc_value = calculate_crc_32u(crc_value, reflect_data ? reverse(src[byte]) : src[byte], polynomial);
     }
 
     return crc_value;
 }
+
+uint32_t dml_ref_crc_32u(const uint8_t *src, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial)
+{
+    return own_crc_32u(src, transfer_size, crc_value, polynomial, false);
+}
+
+uint32_t dml_ref_crc_reflected_u32(const uint8_t *src, uint32_t transfer_size, uint32_t crc_value, uint32_t polynomial)
+{
+    return own_crc_32u(src, transfer_size, crc_value, polynomial, true);
+}
+
+static inline uint32_t multiply_modulo_32u(uint32_t lhs, uint32_t rhs, uint32_t polynomial)
+{
+    const uint32_t high_bit_mask = 1u << 31u;
+
+    uint32_t product = 0u;
+
+    for (uint32_t bit = high_bit_mask; bit != 0u; bit >>= 1u)
+    {
+        product = (product & high_bit_mask) ? ((product << 1) ^ polynomial) : (product << 1);
+        product ^= (rhs & bit) ? lhs : 0u;
+    }
+
+    return product;
+}
+
+uint32_t dml_ref_crc_shift_32u(uint32_t crc_value, uint64_t byte_count, uint32_t polynomial)
+{
+    // Appending a zero byte multiplies the CRC by x^8, so byte_count of them multiply it by x^(8 * byte_count)
+    uint32_t factor = 1u;
+    uint32_t power  = 0x100u;
+
+    for (; byte_count != 0u; byte_count >>= 1u)
+    {
+        if (byte_count & 1u)
+        {
+            factor = multiply_modulo_32u(factor, power, polynomial);
+        }
+
+        power = multiply_modulo_32u(power, power, polynomial);
+    }
+
+    return multiply_modulo_32u(crc_value, factor, polynomial);
+}
@@ -6,6 +6,9 @@
 
 #include "../dml_kernels.h"
 
+#include <algorithm>
+#include <thread>
+
 #if defined(__linux__)
 #include <x86intrin.h>
 #else
@@ -47,3 +50,117 @@ extern "C" void dml_wait_umwait(const volatile uint8_t* const pointer)
     dml_wait_busy_poll(pointer);
 #endif
 }
+
+namespace
+{
+    /** Completions of small operations usually arrive within this time, sleeping would only add wake-up latency */
+    constexpr uint64_t spin_cycles = 4096u;
+
+    /** C0.2 saves more power but takes longer to wake up from, so it is only worth it for long sleeps */
+    constexpr uint64_t deep_sleep_cycles = 100000u;
+
+#if defined(__linux__)
+    /**
+     * @brief Sleeps until the byte is written or the deadline passes, the OS may end the sleep earlier
+     */
+    inline void umwait(const volatile uint8_t *const pointer, uint64_t deadline)
+    {
+        // UMONITOR
+        asm volatile(".byte 0xf3, 0x48, 0x0f, 0xae, 0xf0" : : "a"(pointer));
+
+        // A write that happened before the monitor was armed would not wake us up
+        if (*pointer != 0)
+        {
+            return;
+        }
+
+        const auto state         = uint32_t((deadline - __rdtsc() > deep_sleep_cycles) ? 0u : 1u);
+        const auto deadline_low  = static_cast<uint32_t>(deadline);
+        const auto deadline_high = static_cast<uint32_t>(deadline >> 32);
+
+        auto r = uint8_t(0);
+
+        // UMWAIT
+        asm volatile(".byte 0xf2, 0x48, 0x0f, 0xae, 0xf1\t\n"
+                     "setc %0\t\n"
+                     : "=r"(r)
+                     : "c"(state), "a"(deadline_low), "d"(deadline_high));
+    }
+#endif
+
+    /*
+     * Spins for a short time, then sleeps until the expected completion time with some slack,
+     * then gives the core away to other threads until the byte is written
+     */
+    template <bool use_umwait>
+    uint64_t wait_adaptive(const volatile uint8_t *const pointer, uint64_t expected_cycles)
+    {
+        const auto start          = __rdtsc();
+        const auto spin_deadline  = start + std::min(spin_cycles, expected_cycles);
+        const auto sleep_deadline = start + expected_cycles + expected_cycles / 2u + spin_cycles;
+
+        while (*pointer == 0 && __rdtsc() < spin_deadline)
+        {
+            _mm_pause();
+        }
+
+        while (*pointer == 0)
+        {
+            const auto now = __rdtsc();
+
+            if (now >= sleep_deadline)
+            {
+                std::this_thread::yield();
+            }
+            else if constexpr (use_umwait)
+            {
+#if defined(__linux__)
+                umwait(pointer, sleep_deadline);
+#else
+                _mm_pause();
+#endif
+            }
+            else
+            {
+                _mm_pause();
+            }
+        }
+
+        return __rdtsc() - start;
+    }
+}  // namespace
+
+extern "C" uint64_t dml_wait_adaptive(const volatile uint8_t *const pointer, uint64_t expected_cycles)
+{
+    return wait_adaptive<false>(pointer, expected_cycles);
+}
+
+extern "C" uint64_t dml_wait_adaptive_umwait(const volatile uint8_t *const pointer, uint64_t expected_cycles)
+{
+    return wait_adaptive<true>(pointer, expected_cycles);
+}
+
+extern "C" void dml_wait_timed(const volatile uint8_t *const pointer, uint64_t cycles)
+{
+    const auto deadline = __rdtsc() + cycles;
+
+    while (*pointer == 0 && __rdtsc() < deadline)
+    {
+        _mm_pause();
+    }
+}
+
+extern "C" void dml_wait_timed_umwait(const volatile uint8_t *const pointer, uint64_t cycles)
+{
+#if defined(__linux__)
+    const auto deadline = __rdtsc() + cycles;
+
+    // The OS may limit the sleep time, so it is resumed until the deadline
+    while (*pointer == 0 && __rdtsc() < deadline)
+    {
+        umwait(pointer, deadline);
+    }
+#else
+    dml_wait_timed(pointer, cycles);
+#endif
+}
@@ -0,0 +1,157 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "parallel_pool.hpp"
+
+#include <cstdlib>
+
+namespace dml::core::engine
+{
+    // Split transfers must still give every thread enough work to amortize the hand-off
+    static constexpr std::uint32_t default_threshold = 4u * 1024u * 1024u;
+    static constexpr std::uint32_t min_chunk_size    = 256u * 1024u;
+
+    static auto get_env_value(const char *name, std::uint32_t default_value) noexcept -> std::uint32_t
+    {
+        const auto *value = std::getenv(name);
+
+        if (value == nullptr)
+        {
+            return default_value;
+        }
+
+        const auto number = std::strtol(value, nullptr, 10);
+
+        return number > 0 ? static_cast<std::uint32_t>(number) : 0u;
+    }
+
+    parallel_pool::parallel_pool() noexcept
+    {
+#if defined(__linux__)
+        const auto helper_count = get_env_value("DML_SW_PARALLEL_THREADS", 0u);
+
+        threshold_ = get_env_value("DML_SW_PARALLEL_THRESHOLD", default_threshold);
+
+        for (std::uint32_t i = 0u; i < helper_count; ++i)
+        {
+            helpers_.emplace_back(&parallel_pool::process, this);
+        }
+#endif
+    }
+
+    parallel_pool::~parallel_pool() noexcept
+    {
+        {
+            std::lock_guard<std::mutex> lock(guard_);
+            stop_requested_ = true;
+        }
+        wakeup_.notify_all();
+
+        for (auto &helper : helpers_)
+        {
+            helper.join();
+        }
+    }
+
+    auto parallel_pool::get_instance() noexcept -> parallel_pool &
+    {
+        static parallel_pool instance{};
+
+        return instance;
+    }
+
+    auto parallel_pool::split(std::uint32_t transfer_size, std::uint32_t granularity) const noexcept -> chunking
+    {
+        if (helpers_.empty() || transfer_size < threshold_)
+        {
+            return { transfer_size, transfer_size, 1u };
+        }
+
+        const auto thread_count = static_cast<std::uint64_t>(helpers_.size()) + 1u;
+
+        auto size = (transfer_size + thread_count - 1u) / thread_count;
+        size      = (size < min_chunk_size) ? min_chunk_size : size;
+        size      = (size + granularity - 1u) & ~static_cast<std::uint64_t>(granularity - 1u);
+
+        if (size >= transfer_size)
+        {
+            return { transfer_size, transfer_size, 1u };
+        }
+
+        const auto chunk_size = static_cast<std::uint32_t>(size);
+
+        return { transfer_size, chunk_size, static_cast<std::uint32_t>((transfer_size + size - 1u) / size) };
+    }
+
+    auto parallel_pool::thread_count() const noexcept -> std::uint32_t
+    {
+        return static_cast<std::uint32_t>(helpers_.size()) + 1u;
+    }
+
+    void parallel_pool::run(std::uint32_t chunk_count, void (*function)(void *, std::uint32_t), void *context) noexcept
+    {
+        job current_job{ function, context, chunk_count };
+
+        {
+            std::lock_guard<std::mutex> lock(guard_);
+            jobs_.push_back(&current_job);
+        }
+        wakeup_.notify_all();
+
+        // Caller processes chunks too, so the job completes even if every helper is busy
+        for (auto chunk = current_job.next_chunk.fetch_add(1u); chunk < chunk_count; chunk = current_job.next_chunk.fetch_add(1u))
+        {
+            function(context, chunk);
+            current_job.done_chunks.fetch_add(1u, std::memory_order_release);
+        }
+
+        while (current_job.done_chunks.load(std::memory_order_acquire) != chunk_count)
+        {
+            std::this_thread::yield();
+        }
+
+        // Helpers only touch a job while it is queued, so it is safe to leave after removal
+        std::lock_guard<std::mutex> lock(guard_);
+        for (auto it = jobs_.begin(); it != jobs_.end(); ++it)
+        {
+            if (*it == &current_job)
+            {
+                jobs_.erase(it);
+                break;
+            }
+        }
+    }
+
+    void parallel_pool::process() noexcept
+    {
+        std::unique_lock<std::mutex> lock(guard_);
+
+        while (true)
+        {
+            wakeup_.wait(lock, [this]() { return !jobs_.empty() || stop_requested_; });
+
+            if (stop_requested_)
+            {
+                return;
+            }
+
+            auto      *current_job = jobs_.front();
+            const auto chunk       = current_job->next_chunk.fetch_add(1u);
+
+            if (chunk >= current_job->chunk_count)
+            {
+                // Every chunk is taken, the owner removes the job when the last one is done
+                jobs_.pop_front();
+                continue;
+            }
+
+            lock.unlock();
+            current_job->function(current_job->context, chunk);
+            current_job->done_chunks.fetch_add(1u, std::memory_order_release);
+            lock.lock();
+        }
+    }
+}  // namespace dml::core::engine
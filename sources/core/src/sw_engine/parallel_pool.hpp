@@ -0,0 +1,127 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef DML_CORE_SW_ENGINE_PARALLEL_POOL_HPP
+#define DML_CORE_SW_ENGINE_PARALLEL_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace dml::core::engine
+{
+    constexpr std::uint32_t cache_line_size = 64u;
+    constexpr std::uint32_t page_size       = 4096u;
+
+    /**
+     * @brief Result of splitting a transfer into chunks
+     */
+    struct chunking
+    {
+        std::uint32_t transfer_size;
+        std::uint32_t chunk_size;
+        std::uint32_t chunk_count;
+    };
+
+    /**
+     * @brief Pool of helper threads used to split large software transfers into chunks
+     *
+     * The caller of run() always takes part in processing its own chunks, so a kernel may be split
+     * from any thread, including software engine workers and pool helpers, without a deadlock.
+     *
+     * The pool is started on first use when the DML_SW_PARALLEL_THREADS environment variable holds
+     * a positive number of helper threads. Transfers of at least DML_SW_PARALLEL_THRESHOLD bytes
+     * (4 MB by default) are split. Otherwise every kernel runs as a single chunk.
+     */
+    class parallel_pool final
+    {
+        struct job
+        {
+            void (*function)(void *context, std::uint32_t chunk);
+            void                      *context;
+            std::uint32_t              chunk_count;
+            std::atomic<std::uint32_t> next_chunk{0u};
+            std::atomic<std::uint32_t> done_chunks{0u};
+        };
+
+    public:
+        parallel_pool(const parallel_pool &) noexcept = delete;
+
+        auto operator=(const parallel_pool &other) noexcept -> parallel_pool & = delete;
+
+        static auto get_instance() noexcept -> parallel_pool &;
+
+        /**
+         * @brief Splits the transfer into chunks, a single chunk is returned if it should not be split
+         *
+         * Chunk size is a multiple of @p granularity, which must be a power of two
+         */
+        [[nodiscard]] auto split(std::uint32_t transfer_size, std::uint32_t granularity) const noexcept -> chunking;
+
+        /**
+         * @brief Returns number of threads taking part in run(), including the caller
+         */
+        [[nodiscard]] auto thread_count() const noexcept -> std::uint32_t;
+
+        /**
+         * @brief Calls function(context, i) for every i in [0, chunk_count) and returns when all calls are done
+         */
+        void run(std::uint32_t chunk_count, void (*function)(void *, std::uint32_t), void *context) noexcept;
+
+        ~parallel_pool() noexcept;
+
+    protected:
+        parallel_pool() noexcept; // shouldn't be used directly, as it starts helper threads
+
+    private:
+        void process() noexcept;
+
+        std::vector<std::thread> helpers_;
+        std::deque<job *>        jobs_;
+        std::mutex               guard_;
+        std::condition_variable  wakeup_;
+        bool                     stop_requested_{false};
+        std::uint32_t            threshold_{0u};
+    };
+
+    /**
+     * @brief Calls body(chunk, offset, size) for every chunk, in parallel if there is more than one
+     */
+    template <typename body_t>
+    inline void parallel_for(const chunking &chunks, body_t &&body) noexcept
+    {
+        if (chunks.chunk_count == 1u)
+        {
+            body(0u, 0u, chunks.transfer_size);
+            return;
+        }
+
+        struct context_t
+        {
+            body_t         &body;
+            const chunking &chunks;
+        } context{ body, chunks };
+
+        parallel_pool::get_instance().run(chunks.chunk_count,
+                                          [](void *raw_context, std::uint32_t chunk)
+                                          {
+                                              auto      &ctx    = *static_cast<context_t *>(raw_context);
+                                              const auto offset = chunk * ctx.chunks.chunk_size;
+                                              const auto size   = (chunk + 1u == ctx.chunks.chunk_count)
+                                                                      ? ctx.chunks.transfer_size - offset
+                                                                      : ctx.chunks.chunk_size;
+
+                                              ctx.body(chunk, offset, size);
+                                          },
+                                          &context);
+    }
+}  // namespace dml::core::engine
+
+#endif  //DML_CORE_SW_ENGINE_PARALLEL_POOL_HPP
@@ -0,0 +1,126 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef DML_CORE_SW_ENGINE_SUBMISSION_RING_HPP
+#define DML_CORE_SW_ENGINE_SUBMISSION_RING_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace dml::core::engine
+{
+    /**
+     * @brief Bounded lock-free multi-producer multi-consumer ring
+     *
+     * Every cell carries a sequence number that tells producers and consumers whether
+     * the cell is free for the current lap, so neither side ever takes a lock.
+     * Capacity must be a power of two.
+     */
+    template <typename value_t>
+    class submission_ring final
+    {
+        static constexpr size_t cache_line_size = 64u;
+
+        struct alignas(cache_line_size) cell
+        {
+            std::atomic<size_t> sequence;
+            value_t             value;
+        };
+
+    public:
+        explicit submission_ring(size_t capacity)
+            : cells_(new cell[capacity]),
+              mask_(capacity - 1u)
+        {
+            for (size_t i = 0u; i < capacity; ++i)
+            {
+                cells_[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        submission_ring(const submission_ring &) = delete;
+
+        auto operator=(const submission_ring &) -> submission_ring & = delete;
+
+        [[nodiscard]] auto try_push(const value_t &value) noexcept -> bool
+        {
+            auto position = tail_.load(std::memory_order_relaxed);
+
+            while (true)
+            {
+                auto &current    = cells_[position & mask_];
+                const auto delta = static_cast<std::ptrdiff_t>(current.sequence.load(std::memory_order_acquire)) -
+                                   static_cast<std::ptrdiff_t>(position);
+
+                if (delta == 0)
+                {
+                    if (tail_.compare_exchange_weak(position, position + 1u, std::memory_order_relaxed))
+                    {
+                        current.value = value;
+                        current.sequence.store(position + 1u, std::memory_order_release);
+
+                        return true;
+                    }
+                }
+                else if (delta < 0)
+                {
+                    // Ring is full
+                    return false;
+                }
+                else
+                {
+                    position = tail_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        [[nodiscard]] auto try_pop(value_t &value) noexcept -> bool
+        {
+            auto position = head_.load(std::memory_order_relaxed);
+
+            while (true)
+            {
+                auto &current    = cells_[position & mask_];
+                const auto delta = static_cast<std::ptrdiff_t>(current.sequence.load(std::memory_order_acquire)) -
+                                   static_cast<std::ptrdiff_t>(position + 1u);
+
+                if (delta == 0)
+                {
+                    if (head_.compare_exchange_weak(position, position + 1u, std::memory_order_relaxed))
+                    {
+                        value = current.value;
+                        current.sequence.store(position + mask_ + 1u, std::memory_order_release);
+
+                        return true;
+                    }
+                }
+                else if (delta < 0)
+                {
+                    // Ring is empty
+                    return false;
+                }
+                else
+                {
+                    position = head_.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        [[nodiscard]] auto empty() const noexcept -> bool
+        {
+            return head_.load(std::memory_order_seq_cst) == tail_.load(std::memory_order_seq_cst);
+        }
+
+    private:
+        std::unique_ptr<cell[]>                      cells_;
+        const size_t                                 mask_;
+        alignas(cache_line_size) std::atomic<size_t> head_{0u};
+        alignas(cache_line_size) std::atomic<size_t> tail_{0u};
+    };
+}  // namespace dml::core::engine
+
+#endif  //DML_CORE_SW_ENGINE_SUBMISSION_RING_HPP
@@ -0,0 +1,294 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "sw_engine.hpp"
+
+#include <core/completion_record_views.hpp>
+#include <core/device.hpp>
+#include <core/utils.hpp>
+#include <dml/detail/common/utils/enum.hpp>
+
+#include <cstdlib>
+#include <limits>
+#include <string>
+
+#include "immintrin.h"
+#include "../hw_dispatcher/numa.hpp"
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace dml::core::engine
+{
+    // Number of empty ring checks a worker makes before it goes to sleep
+    static constexpr std::uint32_t idle_spin_count = 256u;
+
+#if defined(__linux__)
+    struct numa_node
+    {
+        std::uint32_t              id;
+        std::vector<std::uint32_t> cpus;
+    };
+
+    static auto parse_cpu_list(const std::string &list) noexcept -> std::vector<std::uint32_t>
+    {
+        std::vector<std::uint32_t> cpus;
+
+        // Format is comma separated ranges, e.g. "0-3,8-11"
+        size_t position = 0u;
+        while (position < list.size())
+        {
+            auto end = list.find(',', position);
+            if (end == std::string::npos)
+            {
+                end = list.size();
+            }
+
+            const auto range = list.substr(position, end - position);
+            const auto dash  = range.find('-');
+
+            const auto first = static_cast<std::uint32_t>(std::strtoul(range.c_str(), nullptr, 10));
+            const auto last  = (dash == std::string::npos)
+                                   ? first
+                                   : static_cast<std::uint32_t>(std::strtoul(range.c_str() + dash + 1u, nullptr, 10));
+
+            for (auto cpu = first; cpu <= last; ++cpu)
+            {
+                cpus.push_back(cpu);
+            }
+
+            position = end + 1u;
+        }
+
+        return cpus;
+    }
+
+    static auto get_numa_nodes() noexcept -> std::vector<numa_node>
+    {
+        std::vector<numa_node> nodes;
+
+        cpu_set_t allowed;
+        CPU_ZERO(&allowed);
+        const bool has_affinity = sched_getaffinity(0, sizeof(allowed), &allowed) == 0;
+
+        const auto cpu_lists = util::read_numa_node_files("cpulist");
+
+        for (std::uint32_t id = 0u; id < cpu_lists.size(); ++id)
+        {
+            numa_node node{id, {}};
+            for (auto cpu : parse_cpu_list(cpu_lists[id]))
+            {
+                if (cpu < CPU_SETSIZE && (!has_affinity || CPU_ISSET(cpu, &allowed)))
+                {
+                    node.cpus.push_back(cpu);
+                }
+            }
+
+            // Memory-only nodes have no CPUs to run workers on
+            if (!node.cpus.empty())
+            {
+                nodes.push_back(std::move(node));
+            }
+        }
+
+        if (nodes.empty())
+        {
+            // No sysfs topology, treat the whole machine as one node
+            numa_node node{0u, {}};
+            for (std::uint32_t cpu = 0u; cpu < CPU_SETSIZE; ++cpu)
+            {
+                if (has_affinity && CPU_ISSET(cpu, &allowed))
+                {
+                    node.cpus.push_back(cpu);
+                }
+            }
+            nodes.push_back(std::move(node));
+        }
+
+        return nodes;
+    }
+
+    static void pin_thread(std::thread &thread, std::uint32_t cpu) noexcept
+    {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(cpu, &cpus);
+
+        // Pinning is an optimization, the worker is still usable if it fails
+        static_cast<void>(pthread_setaffinity_np(thread.native_handle(), sizeof(cpus), &cpus));
+    }
+#endif
+
+    static auto get_workers_per_node() noexcept -> std::uint32_t
+    {
+        const auto *value = std::getenv("DML_SW_WORKERS");
+
+        if (value == nullptr)
+        {
+            return 0u;
+        }
+
+        const auto workers = std::strtol(value, nullptr, 10);
+
+        return workers > 0 ? static_cast<std::uint32_t>(workers) : 0u;
+    }
+
+    sw_engine::sw_engine() noexcept
+    {
+        const auto workers_per_node = get_workers_per_node();
+
+        if (workers_per_node != 0u)
+        {
+            start(workers_per_node);
+        }
+    }
+
+    sw_engine::~sw_engine() noexcept
+    {
+        stop();
+    }
+
+    auto sw_engine::get_instance() noexcept -> sw_engine &
+    {
+        static sw_engine instance{};
+
+        return instance;
+    }
+
+    auto sw_engine::is_enabled() const noexcept -> bool
+    {
+        return enabled_;
+    }
+
+    void sw_engine::start(std::uint32_t workers_per_node) noexcept
+    {
+#if defined(__linux__)
+        for (auto &node : get_numa_nodes())
+        {
+            auto &queue = *queues_.emplace_back(std::make_unique<node_queue>(node.id));
+
+            for (std::uint32_t i = 0u; i < workers_per_node; ++i)
+            {
+                queue.workers.emplace_back(&sw_engine::process, this, std::ref(queue));
+
+                if (!node.cpus.empty())
+                {
+                    pin_thread(queue.workers.back(), node.cpus[i % node.cpus.size()]);
+                }
+            }
+        }
+
+        enabled_ = !queues_.empty();
+#else
+        // Not supported in Windows yet
+        static_cast<void>(workers_per_node);
+#endif
+    }
+
+    void sw_engine::stop() noexcept
+    {
+        enabled_ = false;
+        stop_requested_.store(true);
+
+        for (auto &queue : queues_)
+        {
+            {
+                std::lock_guard<std::mutex> lock(queue->guard);
+            }
+            queue->wakeup.notify_all();
+
+            for (auto &worker : queue->workers)
+            {
+                if (worker.joinable())
+                {
+                    worker.join();
+                }
+            }
+        }
+
+        queues_.clear();
+    }
+
+    auto sw_engine::select_queue(std::uint32_t numa_id) noexcept -> node_queue &
+    {
+        for (auto &queue : queues_)
+        {
+            if (queue->numa_id == numa_id)
+            {
+                return *queue;
+            }
+        }
+
+        // Unknown node, e.g. a memory-only one, is served by the first node
+        return *queues_.front();
+    }
+
+    auto sw_engine::enqueue(const descriptor &dsc, std::uint32_t numa_id) noexcept -> dml::detail::submission_status
+    {
+        auto &queue = select_queue(util::resolve_numa_id(dsc, numa_id));
+
+        if (!queue.ring.try_push(dsc))
+        {
+            return dml::detail::submission_status::queue_busy;
+        }
+
+        // Pairs with the sleeping counter increment in process(): either the worker sees the new
+        // descriptor before it sleeps or we see the worker sleeping and wake it up
+        if (queue.sleeping.load() != 0u)
+        {
+            {
+                std::lock_guard<std::mutex> lock(queue.guard);
+            }
+            queue.wakeup.notify_one();
+        }
+
+        return dml::detail::submission_status::success;
+    }
+
+    void sw_engine::process(node_queue &queue) noexcept
+    {
+        auto dsc        = descriptor();
+        auto idle_spins = 0u;
+
+        while (true)
+        {
+            if (queue.ring.try_pop(dsc))
+            {
+                idle_spins = 0u;
+
+                if (software_device().execute(dsc) != dml::detail::submission_status::success)
+                {
+                    // Report the error the way hardware does, otherwise the waiter never wakes up
+                    auto record = any_completion_record(get_completion_record(dsc));
+                    _mm_mfence();
+                    record.status() = to_underlying(dml::detail::execution_status::operation_error);
+                }
+
+                continue;
+            }
+
+            if (stop_requested_.load())
+            {
+                return;
+            }
+
+            if (++idle_spins < idle_spin_count)
+            {
+                _mm_pause();
+                continue;
+            }
+
+            idle_spins = 0u;
+
+            std::unique_lock<std::mutex> lock(queue.guard);
+            queue.sleeping.fetch_add(1u);
+            queue.wakeup.wait(lock, [&]() { return !queue.ring.empty() || stop_requested_.load(); });
+            queue.sleeping.fetch_sub(1u);
+        }
+    }
+}  // namespace dml::core::engine
@@ -0,0 +1,83 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#ifndef DML_CORE_SW_ENGINE_SW_ENGINE_HPP
+#define DML_CORE_SW_ENGINE_SW_ENGINE_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <core/types.hpp>
+#include <dml/detail/common/status.hpp>
+
+#include "submission_ring.hpp"
+
+namespace dml::core::engine
+{
+    /**
+     * @brief Asynchronous backend for the software path
+     *
+     * Owns a pool of worker threads per NUMA node. Each worker is pinned to a CPU of its node
+     * and takes descriptors from the node's submission ring, so completion records are written
+     * later, the same way a hardware device writes them.
+     *
+     * The pool is started on first use when the DML_SW_WORKERS environment variable holds
+     * a positive number of workers per node. Otherwise the engine stays disabled and
+     * software descriptors are executed in the caller's thread.
+     */
+    class sw_engine final
+    {
+        static constexpr size_t ring_capacity = 256u;
+
+        struct node_queue
+        {
+            explicit node_queue(std::uint32_t id) : numa_id(id), ring(ring_capacity) {}
+
+            std::uint32_t                 numa_id;
+            submission_ring<descriptor>   ring;
+            std::mutex                    guard;
+            std::condition_variable       wakeup;
+            std::atomic<std::uint32_t>    sleeping{0u};
+            std::vector<std::thread>      workers;
+        };
+
+    public:
+        sw_engine(const sw_engine &) noexcept = delete;
+
+        auto operator=(const sw_engine &other) noexcept -> sw_engine & = delete;
+
+        static auto get_instance() noexcept -> sw_engine &;
+
+        [[nodiscard]] auto is_enabled() const noexcept -> bool;
+
+        [[nodiscard]] auto enqueue(const descriptor &dsc, std::uint32_t numa_id) noexcept -> dml::detail::submission_status;
+
+        ~sw_engine() noexcept;
+
+    protected:
+        sw_engine() noexcept; // shouldn't be used directly, as it starts worker threads
+
+    private:
+        void start(std::uint32_t workers_per_node) noexcept;
+
+        void stop() noexcept;
+
+        void process(node_queue &queue) noexcept;
+
+        [[nodiscard]] auto select_queue(std::uint32_t numa_id) noexcept -> node_queue &;
+
+        std::vector<std::unique_ptr<node_queue>> queues_;
+        std::atomic<bool>                        stop_requested_{false};
+        bool                                     enabled_{false};
+    };
+}  // namespace dml::core::engine
+
+#endif  //DML_CORE_SW_ENGINE_SW_ENGINE_HPP
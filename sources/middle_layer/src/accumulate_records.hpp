@@ -124,7 +124,7 @@ namespace dml::detail::ml
         auto compare_record = core::make_view<core::operation::compare>(core::get_completion_record(dsc));
         auto compare_prev_record = core::make_view<core::operation::compare>(prev_record);
 
-        compare_record.bytes_completed() = compare_prev_record.bytes_completed();
+        compare_record.bytes_completed() += compare_prev_record.bytes_completed();
     }
 
     static void accumulate_records_compare_pattern(descriptor& dsc, const completion_record& prev_record) noexcept
@@ -16,6 +16,36 @@
 
 namespace dml::detail::ml::impl
 {
+    namespace
+    {
+        /**
+         * @brief Waits for the completion record, get_estimate is only called by adaptive waits
+         */
+        template <typename get_estimate_t>
+        void wait_for(const descriptor& dsc, wait_mode mode, get_estimate_t&& get_estimate) noexcept
+        {
+            auto& record = core::get_completion_record(dsc);
+
+            if (record.bytes[0])
+            {
+                return;
+            }
+
+            switch (mode)
+            {
+                case wait_mode::umwait:
+                    core::dispatch::wait_umwait(&record.bytes[0]);
+                    break;
+                case wait_mode::adaptive:
+                    core::dispatch::wait_adaptive(&record.bytes[0], core::any_descriptor(dsc).transfer_size(), get_estimate(dsc));
+                    break;
+                default:
+                    core::dispatch::wait_busy_poll(&record.bytes[0]);
+                    break;
+            }
+        }
+    }  // namespace
+
     void rebind(descriptor& dsc, completion_record& record) noexcept
     {
         constexpr auto completion_record_flags =
@@ -34,28 +64,12 @@ namespace dml::detail::ml::impl
 
     submission_status software::submit(const descriptor& dsc, std::uint32_t numa_id) noexcept
     {
-        static_cast<void>(numa_id);
-
-        return core::software_device().submit(dsc);
+        return core::software_device().submit(dsc, numa_id);
     }
 
-    void software::wait(const descriptor& dsc, bool umwait) noexcept
+    void software::wait(const descriptor& dsc, wait_mode mode) noexcept
     {
-        if (finished(dsc))
-        {
-            return;
-        }
-
-        auto& record = core::get_completion_record(dsc);
-
-        if (umwait)
-        {
-            core::dispatch::wait_umwait(&record.bytes[0]);
-        }
-        else
-        {
-            core::dispatch::wait_busy_poll(&record.bytes[0]);
-        }
+        wait_for(dsc, mode, [](const descriptor&) -> auto& { return core::software_device().wait_estimate(); });
     }
 
     bool software::finished(const descriptor& dsc) noexcept
@@ -73,14 +87,23 @@ namespace dml::detail::ml::impl
         return core::hardware_device().submit(dsc, numa_id);
     }
 
-    void hardware::wait(const descriptor& dsc, bool umwait) noexcept
+    void hardware::wait(const descriptor& dsc, wait_mode mode) noexcept
     {
-        software::wait(dsc, umwait);
+        wait_for(dsc, mode, [](const descriptor& dsc) -> auto& { return core::hardware_device().wait_estimate(dsc); });
+
+        core::hardware_device().release(dsc);
     }
 
     bool hardware::finished(const descriptor& dsc) noexcept
     {
-        return software::finished(dsc);
+        if (!software::finished(dsc))
+        {
+            return false;
+        }
+
+        core::hardware_device().release(dsc);
+
+        return true;
     }
 
     [[nodiscard]] validation_status automatic::validate(const descriptor& dsc) noexcept
@@ -95,18 +118,18 @@ namespace dml::detail::ml::impl
         // SW Fallback
         if (status != submission_status::success)
         {
-            return core::software_device().submit(dsc);
+            return core::software_device().submit(dsc, numa_id);
         }
 
         return status;
     }
 
-    void automatic::wait(descriptor& dsc, bool umwait) noexcept
+    void automatic::wait(descriptor& dsc, wait_mode mode) noexcept
     {
         constexpr auto page_fault_mask =
             to_underlying(execution_status::page_fault_during_processing);
 
-        hardware::wait(dsc, umwait);
+        hardware::wait(dsc, mode);
 
         auto& record = core::get_completion_record(dsc);
         auto  status = core::any_completion_record(record).status();
@@ -120,7 +143,7 @@ namespace dml::detail::ml::impl
             // Must not fail
             static_cast<void>(software::submit(dsc, 0));
 
-            software::wait(dsc, umwait);
+            software::wait(dsc, mode);
 
             accumulate_records(dsc, prev_record);
         }
@@ -140,9 +163,9 @@ namespace dml::detail::ml::impl
             auto prev_record = record;
             update_for_continuation(dsc);
             static_cast<void>(software::submit(dsc, 0));
-            software::wait(dsc, true);
-            // software::submit is currently sync, so finished() may be blocking due to it
-            // todo rework accumulate_records if necessary if software::submit is made async
+            // software::submit may be served by the worker pool, so finished() blocks until the
+            // continuation is done to keep the accumulated record consistent
+            software::wait(dsc, wait_mode::umwait);
             accumulate_records(dsc, prev_record);
             return software::finished(dsc);
         }
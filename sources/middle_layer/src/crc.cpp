@@ -0,0 +1,34 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <core/utils.hpp>
+#include <dml/detail/common/utils/enum.hpp>
+#include <dml/detail/ml/crc.hpp>
+#include <optimization_dispatcher.hpp>
+
+namespace dml::detail::ml
+{
+    crc_value_t crc_combine(crc_value_t          crc_a,
+                            crc_value_t          crc_b,
+                            std::uint64_t        length_b,
+                            std::uint32_t        polynomial,
+                            crc_specific_options specific_options) noexcept
+    {
+        const auto bypass_reflection = intersects(static_cast<operation_specific_flags_t>(specific_options),
+                                                  crc_specific_flag::bypass_crc_inversion_and_reflection);
+
+        // Same conversions the CRC operation applies to its seed and result
+        const auto to_state   = [bypass_reflection](std::uint32_t value) { return bypass_reflection ? value : core::reverse_bits(~value); };
+        const auto from_state = [bypass_reflection](std::uint32_t value) { return bypass_reflection ? value : ~core::reverse_bits(value); };
+
+        // CRC is affine in the seed: crc(s, B) = s * x^(8 * |B|) + crc(0, B), so the seed of B is replaced with
+        // the state after A, which is shifted over B using x^n mod P instead of rereading the data
+        const auto zero_state = to_state(0u);
+        const auto state      = core::dispatch::crc_shift(to_state(crc_a) ^ zero_state, length_b, polynomial) ^ to_state(crc_b);
+
+        return from_state(state);
+    }
+}  // namespace dml::detail::ml
@@ -0,0 +1,53 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <core/utils.hpp>
+#include <core/view.hpp>
+#include <dml/detail/common/status.hpp>
+#include <dml/detail/common/utils/enum.hpp>
+#include <dml/detail/ml/direct.hpp>
+#include <dml/detail/ml/impl/core_interconnect.hpp>
+#include <optimization_dispatcher.hpp>
+
+namespace dml::detail::ml::direct
+{
+    static_assert(max_transfer_size + 1u == core::dispatch::min_non_temporal_size,
+                  "Direct execution must end where the software path starts using streaming stores");
+
+    void mem_move(const byte_t* src, byte_t* dst, transfer_size_t size) noexcept
+    {
+        core::dispatch::mem_move(src, dst, size);
+    }
+
+    void fill(pattern_t pattern, byte_t* dst, transfer_size_t size) noexcept
+    {
+        core::dispatch::fill(pattern, dst, size);
+    }
+
+    crc_value_t crc(const byte_t* src, transfer_size_t size, crc_value_t crc_seed, crc_specific_options specific_options) noexcept
+    {
+        const auto flags                  = static_cast<operation_specific_flags_t>(specific_options);
+        const auto bypass_reflection      = intersects(flags, crc_specific_flag::bypass_crc_inversion_and_reflection);
+        const auto bypass_data_reflection = intersects(flags, crc_specific_flag::bypass_data_reflection);
+
+        const auto state = bypass_reflection ? crc_seed : core::reverse_bits(~crc_seed);
+        const auto value = bypass_data_reflection ? core::dispatch::crc(src, size, state) : core::dispatch::crc_reflected(src, size, state);
+
+        return bypass_reflection ? value : ~core::reverse_bits(value);
+    }
+
+    void complete(task_view task, crc_value_t crc_value) noexcept
+    {
+        auto& record = task.get_completion_record();
+
+        impl::rebind(task.get_descriptor(), record);
+
+        record = completion_record();
+
+        core::make_view<core::operation::crc>(record).crc_value() = crc_value;
+        core::any_completion_record(record).status()              = to_underlying(execution_status::success);
+    }
+}  // namespace dml::detail::ml::direct
@@ -0,0 +1,49 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <dml/detail/ml/wait.hpp>
+#include <optimization_dispatcher.hpp>
+
+#include <thread>
+
+#include "immintrin.h"
+
+namespace dml::detail::ml
+{
+    void rest_between_scans(completion_record& record, wait_mode mode, std::uint32_t scan) noexcept
+    {
+        // Other records are scanned at least that often, a few microseconds
+        constexpr std::uint64_t sleep_cycles = 8192u;
+
+        // Adaptive mode spins first, sleeps for a few milliseconds in total, then gives the core away
+        constexpr std::uint32_t spin_scans  = 64u;
+        constexpr std::uint32_t sleep_scans = 1024u;
+
+        switch (mode)
+        {
+            case wait_mode::umwait:
+                core::dispatch::wait_timed(&record.bytes[0], sleep_cycles);
+                break;
+            case wait_mode::adaptive:
+                if (scan < spin_scans)
+                {
+                    _mm_pause();
+                }
+                else if (scan < spin_scans + sleep_scans)
+                {
+                    core::dispatch::wait_timed(&record.bytes[0], sleep_cycles);
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+                break;
+            default:
+                _mm_pause();
+                break;
+        }
+    }
+}  // namespace dml::detail::ml
@@ -0,0 +1,92 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <dml/dml.hpp>
+
+#include <utility.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace bench;
+
+namespace
+{
+// Spawner that was used by the software path before the work-stealing executor
+struct detached_thread_spawner_t
+{
+    template <typename task_t>
+    void operator()(task_t &&task) const
+    {
+        std::thread(std::forward<task_t>(task)).detach();
+    }
+};
+
+template <typename executor_t>
+class spawn_t
+{
+public:
+    void operator()(benchmark::State &state, const executor_t &executor, size_t size, std::int32_t queue_size) const
+    {
+        std::vector<std::vector<std::uint8_t>> src(queue_size, std::vector<std::uint8_t>(size, 7u));
+        std::vector<std::vector<std::uint8_t>> dst(queue_size, std::vector<std::uint8_t>(size, 0u));
+
+        std::atomic<std::int32_t> completed{0};
+        std::atomic<bool>         failed{false};
+
+        for (auto _ : state)
+        {
+            completed.store(0);
+
+            for (std::int32_t i = 0; i < queue_size; ++i)
+            {
+                executor([&, i]() {
+                    auto result = dml::execute<dml::software>(dml::mem_move, dml::make_view(src[i]), dml::make_view(dst[i]));
+                    if (result.status != dml::status_code::ok)
+                        failed.store(true);
+                    completed.fetch_add(1);
+                });
+            }
+
+            while (completed.load() != queue_size)
+                std::this_thread::yield();
+        }
+
+        if (failed.load() || src != dst)
+            state.SkipWithError("spawn_t::operator(): Verification failed");
+
+        state.SetItemsProcessed(state.iterations() * queue_size);
+        state.SetBytesProcessed(state.iterations() * queue_size * size);
+    }
+};
+}
+
+BENCHMARK_SET_DELAYED(executor)
+{
+    std::vector<size_t>       sizes       = (cmd::get_block_size() >= 0) ? std::vector<size_t>{(size_t)cmd::get_block_size()} : std::vector<size_t>{64, 1024, 4096, 65536};
+    std::vector<std::int32_t> queue_sizes = (cmd::FLAGS_queue_size > 0)  ? std::vector<std::int32_t>{cmd::FLAGS_queue_size} : std::vector<std::int32_t>{16, 128};
+
+    const auto thread_count = (cmd::FLAGS_threads > 0) ? (std::uint32_t)cmd::FLAGS_threads : dml::work_stealing_executor::default_thread_count();
+
+    for (auto size : sizes)
+    {
+        for (auto queue_size : queue_sizes)
+        {
+            auto name = format("executor/size:%zu/queue_size:%d", size, queue_size);
+
+            benchmark::RegisterBenchmark((name + "/spawner:detached_thread").c_str(), [=](benchmark::State &state) {
+                spawn_t<detached_thread_spawner_t>{}(state, detached_thread_spawner_t{}, size, queue_size);
+            })->UseRealTime();
+
+            benchmark::RegisterBenchmark((name + "/spawner:work_stealing").c_str(), [=](benchmark::State &state) {
+                spawn_t<dml::work_stealing_executor>{}(state, dml::work_stealing_executor(thread_count), size, queue_size);
+            })->UseRealTime();
+        }
+    }
+}
@@ -0,0 +1,330 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <dml_cpuid.h>
+#include <dml_kernels.h>
+
+#include <utility.hpp>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace bench;
+
+namespace
+{
+// Software kernels are called directly, so every instruction set tier available on the host is measured
+struct kernel_buffers_t
+{
+    explicit kernel_buffers_t(size_t size):
+        src1(size, 7u), src2(size, 7u), dst1(size, 0u), dst2(size, 0u), delta(size / 8u * 10u + 10u, 0u)
+    {
+    }
+
+    std::vector<std::uint8_t> src1;
+    std::vector<std::uint8_t> src2;
+    std::vector<std::uint8_t> dst1;
+    std::vector<std::uint8_t> dst2;
+    std::vector<std::uint8_t> delta;
+};
+
+// Guards of the DIF blocks are written to the second destination
+inline std::uint16_t *crc16s(kernel_buffers_t &buffers)
+{
+    return reinterpret_cast<std::uint16_t *>(buffers.dst2.data());
+}
+
+using kernel_t = std::function<void(kernel_buffers_t &, std::uint32_t)>;
+
+using apply_delta_t = void (*)(const std::uint8_t *, std::uint8_t *, std::uint32_t);
+
+struct tier_kernels_t
+{
+    const char   *name;
+    bool          supported;
+    kernel_t      mem_move;
+    kernel_t      fill;
+    kernel_t      compare;
+    kernel_t      compare_pattern;
+    kernel_t      create_delta;
+    kernel_t      dualcast;
+    kernel_t      crc;
+    kernel_t      crc_ieee;
+    kernel_t      copy_crc;
+    kernel_t      mem_move_nt;
+    kernel_t      fill_nt;
+    kernel_t      crc16_t10;
+    kernel_t      copy_crc16_t10;
+    kernel_t      crc_multi;
+    apply_delta_t apply_delta;
+};
+
+constexpr std::uint64_t pattern = 0x0707070707070707u;
+
+constexpr std::uint32_t crc_polynomial = 0x1EDC6F41u;
+
+constexpr std::uint32_t crc_ieee_polynomial = 0x04C11DB7u;
+
+constexpr std::uint32_t dif_block_size = 512u;
+
+constexpr std::uint32_t dif_block_stride = dif_block_size + 8u;
+
+constexpr std::uint32_t crc_multi_buffer_size = 1024u;
+
+using crc_multi_kernel_t = void (*)(const std::uint8_t *const *, const std::uint32_t *, std::uint32_t, std::uint32_t *, std::uint32_t);
+
+// The first source is hashed as independent buffers, as many at once as the core library passes to the kernel
+inline void crc_multi(crc_multi_kernel_t kernel, kernel_buffers_t &buffers, std::uint32_t size)
+{
+    constexpr std::uint32_t max_count = 64u;
+
+    const std::uint8_t *srcs[max_count];
+    std::uint32_t       sizes[max_count];
+    std::uint32_t       crcs[max_count];
+
+    for (std::uint32_t offset = 0u; offset + crc_multi_buffer_size <= size;)
+    {
+        std::uint32_t count = 0u;
+
+        for (; count < max_count && offset + crc_multi_buffer_size <= size; ++count, offset += crc_multi_buffer_size)
+        {
+            srcs[count]  = buffers.src1.data() + offset;
+            sizes[count] = crc_multi_buffer_size;
+            crcs[count]  = 0u;
+        }
+
+        kernel(srcs, sizes, count, crcs, crc_polynomial);
+        benchmark::DoNotOptimize(crcs);
+    }
+}
+
+std::vector<tier_kernels_t> get_tiers()
+{
+    const auto registers = dml_core_cpuid(DML_CPUID_EXTENSIONS);
+    const auto features  = dml_core_cpuid(DML_CPUID_FEATURES);
+
+    std::vector<tier_kernels_t> tiers;
+
+    tiers.push_back({"ref",
+                     true,
+                     [](kernel_buffers_t &b, std::uint32_t size) { dml_ref_mem_move(b.src1.data(), b.dst1.data(), size); },
+                     [](kernel_buffers_t &b, std::uint32_t size) { dml_ref_fill_u64(pattern, b.dst1.data(), size); },
+                     [](kernel_buffers_t &b, std::uint32_t size) {
+                         std::uint8_t result = 0u;
+                         benchmark::DoNotOptimize(dml_ref_compare(b.src1.data(), b.src2.data(), size, &result));
+                     },
+                     [](kernel_buffers_t &b, std::uint32_t size) {
+                         std::uint8_t result = 0u;
+                         benchmark::DoNotOptimize(dml_ref_compare_pattern(pattern, b.src1.data(), size, &result));
+                     },
+                     [](kernel_buffers_t &b, std::uint32_t size) {
+                         std::uint8_t result = 0u;
+                         benchmark::DoNotOptimize(dml_ref_create_delta(
+                             b.src1.data(), b.src2.data(), size, b.delta.data(), (std::uint32_t)b.delta.size(), &result));
+                     },
+                     [](kernel_buffers_t &b, std::uint32_t size) { dml_ref_dualcast(b.src1.data(), b.dst1.data(), b.dst2.data(), size); },
+                     [](kernel_buffers_t &b, std::uint32_t size) {
+                         benchmark::DoNotOptimize(dml_ref_crc_32u(b.src1.data(), size, 0u, crc_polynomial));
+                     },
+                     [](kernel_buffers_t &b, std::uint32_t size) {
+                         benchmark::DoNotOptimize(dml_ref_crc_32u(b.src1.data(), size, 0u, crc_ieee_polynomial));
+                     },
+                     [](kernel_buffers_t &b, std::uint32_t size) {
+                         benchmark::DoNotOptimize(dml_ref_copy_crc_u32(b.src1.data(), b.dst1.data(), size, 0u, crc_polynomial));
+                     },
+                     nullptr,
+                     nullptr,
+                     [](kernel_buffers_t &b, std::uint32_t size) {
+                         dml_ref_crc16_t10_blocks(b.src1.data(), dif_block_size, dif_block_stride, size / dif_block_stride, 0u, crc16s(b));
+                     },
+                     [](kernel_buffers_t &b, std::uint32_t size) {
+                         dml_ref_copy_crc16_t10_blocks(b.src1.data(), dif_block_size, b.dst1.data(), dif_block_stride, dif_block_size, size / dif_block_stride, 0u, crc16s(b));
+                     },
+                     [](kernel_buffers_t &b, std::uint32_t size) { crc_multi(dml_ref_crc_multi_u32, b, size); },
+                     dml_ref_apply_delta});
+
+    tiers.push_back({"avx2",
+                     (registers.ebx & DML_AVX2) == DML_AVX2,
+                     [](kernel_buffers_t &b, std::uint32_t size) { dml_avx2_mem_move(b.src1.data(), b.dst1.data(), size); },
+                     [](kernel_buffers_t &b, std::uint32_t size) { dml_avx2_fill_u64(pattern, b.dst1.data(), size); },
+                     [](kernel_buffers_t &b, std::uint32_t size) {
+                         std::uint8_t result = 0u;
+                         benchmark::DoNotOptimize(dml_avx2_compare(b.src1.data(), b.src2.data(), size, &result));
+                     },
+                     [](kernel_buffers_t &b, std::uint32_t size) {
+                         std::uint8_t result = 0u;
+                         benchmark::DoNotOptimize(dml_avx2_compare_pattern(pattern, b.src1.data(), size, &result));
+                     },
+                     [](kernel_buffers_t &b, std::uint32_t size) {
+                         std::uint8_t result = 0u;
+                         benchmark::DoNotOptimize(dml_avx2_create_delta(
+                             b.src1.data(), b.src2.data(), size, b.delta.data(), (std::uint32_t)b.delta.size(), &result));
+                     },
+                     [](kernel_buffers_t &b, std::uint32_t size) { dml_avx2_dualcast(b.src1.data(), b.dst1.data(), b.dst2.data(), size); },
+                     nullptr,
+                     nullptr,
+                     nullptr,
+                     nullptr,
+                     nullptr,
+                     nullptr,
+                     nullptr,
+                     nullptr,
+                     nullptr});
+
+    tiers.push_back({"pclmul",
+                     (features.ecx & (DML_PCLMULQDQ | DML_SSE42)) == (DML_PCLMULQDQ | DML_SSE42),
+                     nullptr,
+                     nullptr,
+                     nullptr,
+                     nullptr,
+                     nullptr,
+                     nullptr,
+                     [](kernel_buffers_t &b, std::uint32_t size) {
+                         benchmark::DoNotOptimize(dml_pclmul_crc_u32(b.src1.data(), size, 0u, crc_polynomial));
+                     },
+                     [](kernel_buffers_t &b, std::uint32_t size) {
+                         benchmark::DoNotOptimize(dml_pclmul_crc_u32(b.src1.data(), size, 0u, crc_ieee_polynomial));
+                     },
+                     [](kernel_buffers_t &b, std::uint32_t size) {
+                         benchmark::DoNotOptimize(dml_pclmul_copy_crc_u32(b.src1.data(), b.dst1.data(), size, 0u, crc_polynomial));
+                     },
+                     nullptr,
+                     nullptr,
+                     [](kernel_buffers_t &b, std::uint32_t size) {
+                         dml_pclmul_crc16_t10_blocks(b.src1.data(), dif_block_size, dif_block_stride, size / dif_block_stride, 0u, crc16s(b));
+                     },
+                     [](kernel_buffers_t &b, std::uint32_t size) {
+                         dml_pclmul_copy_crc16_t10_blocks(b.src1.data(), dif_block_size, b.dst1.data(), dif_block_stride, dif_block_size, size / dif_block_stride, 0u, crc16s(b));
+                     },
+                     [](kernel_buffers_t &b, std::uint32_t size) { crc_multi(dml_pclmul_crc_multi_u32, b, size); },
+                     nullptr});
+
+    tiers.push_back({"avx512",
+                     (registers.ebx & DML_AVX512_MASK) == DML_AVX512_MASK,
+                     [](kernel_buffers_t &b, std::uint32_t size) { dml_avx512_mem_move(b.src1.data(), b.dst1.data(), size); },
+                     [](kernel_buffers_t &b, std::uint32_t size) { dml_avx512_fill_u64(pattern, b.dst1.data(), size); },
+                     [](kernel_buffers_t &b, std::uint32_t size) {
+                         std::uint8_t result = 0u;
+                         benchmark::DoNotOptimize(dml_avx512_compare(b.src1.data(), b.src2.data(), size, &result));
+                     },
+                     [](kernel_buffers_t &b, std::uint32_t size) {
+                         std::uint8_t result = 0u;
+                         benchmark::DoNotOptimize(dml_avx512_compare_pattern(pattern, b.src1.data(), size, &result));
+                     },
+                     [](kernel_buffers_t &b, std::uint32_t size) {
+                         std::uint8_t result = 0u;
+                         benchmark::DoNotOptimize(dml_avx512_create_delta(
+                             b.src1.data(), b.src2.data(), size, b.delta.data(), (std::uint32_t)b.delta.size(), &result));
+                     },
+                     [](kernel_buffers_t &b, std::uint32_t size) { dml_avx512_dualcast(b.src1.data(), b.dst1.data(), b.dst2.data(), size); },
+                     nullptr,
+                     nullptr,
+                     ((registers.ecx & DML_VPCLMULQDQ) == DML_VPCLMULQDQ) ? kernel_t([](kernel_buffers_t &b, std::uint32_t size) {
+                         benchmark::DoNotOptimize(dml_avx512_copy_crc_u32(b.src1.data(), b.dst1.data(), size, 0u, crc_polynomial));
+                     })
+                                                                           : kernel_t(),
+                     [](kernel_buffers_t &b, std::uint32_t size) { dml_avx512_mem_move_nt(b.src1.data(), b.dst1.data(), size); },
+                     [](kernel_buffers_t &b, std::uint32_t size) { dml_avx512_fill_u64_nt(pattern, b.dst1.data(), size); },
+                     ((registers.ecx & DML_VPCLMULQDQ) == DML_VPCLMULQDQ) ? kernel_t([](kernel_buffers_t &b, std::uint32_t size) {
+                         dml_avx512_crc16_t10_blocks(b.src1.data(), dif_block_size, dif_block_stride, size / dif_block_stride, 0u, crc16s(b));
+                     })
+                                                                           : kernel_t(),
+                     ((registers.ecx & DML_VPCLMULQDQ) == DML_VPCLMULQDQ) ? kernel_t([](kernel_buffers_t &b, std::uint32_t size) {
+                         dml_avx512_copy_crc16_t10_blocks(b.src1.data(), dif_block_size, b.dst1.data(), dif_block_stride, dif_block_size, size / dif_block_stride, 0u, crc16s(b));
+                     })
+                                                                           : kernel_t(),
+                     ((registers.ecx & DML_VPCLMULQDQ) == DML_VPCLMULQDQ) ? kernel_t([](kernel_buffers_t &b, std::uint32_t size) {
+                         crc_multi(dml_avx512_crc_multi_u32, b, size);
+                     })
+                                                                           : kernel_t(),
+                     dml_avx512_apply_delta});
+
+    return tiers;
+}
+
+void register_kernel(const char *operation, const tier_kernels_t &tier, const kernel_t &kernel, size_t size)
+{
+    if (!tier.supported || !kernel)
+        return;
+
+    auto name = format("kernel/%s/size:%zu/isa:%s", operation, size, tier.name);
+
+    benchmark::RegisterBenchmark(name.c_str(), [kernel, size](benchmark::State &state) {
+        kernel_buffers_t buffers(size);
+
+        for (auto _ : state)
+        {
+            kernel(buffers, (std::uint32_t)size);
+            benchmark::ClobberMemory();
+        }
+
+        state.SetBytesProcessed(state.iterations() * size);
+    });
+}
+
+void register_apply_delta(const char *shape, const tier_kernels_t &tier, size_t size, size_t block_step)
+{
+    // Delta offsets address at most 64K blocks
+    if (!tier.supported || !tier.apply_delta || (size / sizeof(std::uint64_t)) > 65536u)
+        return;
+
+    auto name = format("kernel/apply_delta/shape:%s/size:%zu/isa:%s", shape, size, tier.name);
+
+    benchmark::RegisterBenchmark(name.c_str(), [apply_delta = tier.apply_delta, size, block_step](benchmark::State &state) {
+        kernel_buffers_t buffers(size);
+
+        for (size_t offset = 0u; offset < size / sizeof(std::uint64_t); offset += block_step)
+            buffers.src2[offset * sizeof(std::uint64_t)] ^= 1u;
+
+        std::uint8_t result      = 0u;
+        const auto   record_size = dml_ref_create_delta(buffers.src1.data(),
+                                                      buffers.src2.data(),
+                                                      (std::uint32_t)size,
+                                                      buffers.delta.data(),
+                                                      (std::uint32_t)buffers.delta.size(),
+                                                      &result);
+
+        for (auto _ : state)
+        {
+            apply_delta(buffers.delta.data(), buffers.dst1.data(), record_size);
+            benchmark::ClobberMemory();
+        }
+
+        state.SetBytesProcessed(state.iterations() * record_size);
+    });
+}
+}
+
+BENCHMARK_SET_DELAYED(kernels)
+{
+    std::vector<size_t> sizes = (cmd::get_block_size() >= 0) ? std::vector<size_t>{(size_t)cmd::get_block_size()} : std::vector<size_t>{4096, 65536, 1048576};
+
+    for (const auto &tier : get_tiers())
+    {
+        for (auto size : sizes)
+        {
+            register_kernel("mem_move", tier, tier.mem_move, size);
+            register_kernel("fill", tier, tier.fill, size);
+            register_kernel("compare", tier, tier.compare, size);
+            register_kernel("compare_pattern", tier, tier.compare_pattern, size);
+            register_kernel("create_delta", tier, tier.create_delta, size);
+            register_kernel("dualcast", tier, tier.dualcast, size);
+            register_kernel("crc", tier, tier.crc, size);
+            register_kernel("crc_ieee", tier, tier.crc_ieee, size);
+            register_kernel("copy_crc", tier, tier.copy_crc, size);
+            register_kernel("mem_move_nt", tier, tier.mem_move_nt, size);
+            register_kernel("fill_nt", tier, tier.fill_nt, size);
+            register_kernel("crc16_t10", tier, tier.crc16_t10, size);
+            register_kernel("copy_crc16_t10", tier, tier.copy_crc16_t10, size);
+            register_kernel("crc_multi", tier, tier.crc_multi, size);
+            register_apply_delta("dense", tier, size, 1u);
+            register_apply_delta("sparse", tier, size, 64u);
+        }
+    }
+}
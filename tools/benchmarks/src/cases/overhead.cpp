@@ -0,0 +1,206 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <dml/dml.h>
+#include <dml/dml.hpp>
+
+#include <utility.hpp>
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+using namespace bench;
+
+namespace
+{
+// Per-operation cost of the software path for transfers where the kernel itself takes a few nanoseconds.
+// api:execute goes through direct kernel calls, api:submit still builds and validates a descriptor,
+// api:memory is the bare standard library call for reference.
+enum class overhead_op_e
+{
+    mem_move,
+    fill,
+    crc
+};
+
+constexpr std::uint64_t pattern = 0x0707070707070707u;
+
+inline const char *op_name(overhead_op_e op)
+{
+    switch (op)
+    {
+        case overhead_op_e::mem_move: return "mem_move";
+        case overhead_op_e::fill:     return "fill";
+        case overhead_op_e::crc:      return "crc";
+    }
+
+    return "";
+}
+
+struct overhead_buffers_t
+{
+    explicit overhead_buffers_t(size_t size): src(size, 7u), dst(size, 0u)
+    {
+    }
+
+    std::vector<std::uint8_t> src;
+    std::vector<std::uint8_t> dst;
+    std::uint32_t             crc_value{0u};
+};
+
+void run_memory(benchmark::State &state, overhead_op_e op, overhead_buffers_t &buffers)
+{
+    for (auto _ : state)
+    {
+        if (op == overhead_op_e::fill)
+            std::memset(buffers.dst.data(), 7, buffers.dst.size());
+        else
+            std::memcpy(buffers.dst.data(), buffers.src.data(), buffers.src.size());
+
+        benchmark::DoNotOptimize(buffers.dst.data());
+        benchmark::ClobberMemory();
+    }
+}
+
+template <bool direct>
+dml::status_code run_cpp_once(overhead_op_e op, overhead_buffers_t &buffers)
+{
+    auto src = dml::make_view(buffers.src);
+    auto dst = dml::make_view(buffers.dst);
+
+    switch (op)
+    {
+        case overhead_op_e::mem_move:
+            return direct ? dml::execute<dml::software>(dml::mem_move, src, dst).status
+                          : dml::submit<dml::software>(dml::mem_move, src, dst).get().status;
+        case overhead_op_e::fill:
+            return direct ? dml::execute<dml::software>(dml::fill, pattern, dst).status
+                          : dml::submit<dml::software>(dml::fill, pattern, dst).get().status;
+        case overhead_op_e::crc:
+        {
+            auto result = direct ? dml::execute<dml::software>(dml::crc, src, 0u) : dml::submit<dml::software>(dml::crc, src, 0u).get();
+            buffers.crc_value = result.crc_value;
+            return result.status;
+        }
+    }
+
+    return dml::status_code::error;
+}
+
+template <bool direct>
+void run_cpp(benchmark::State &state, overhead_op_e op, overhead_buffers_t &buffers)
+{
+    for (auto _ : state)
+    {
+        if (run_cpp_once<direct>(op, buffers) != dml::status_code::ok)
+        {
+            state.SkipWithError("overhead: operation failed");
+            return;
+        }
+
+        benchmark::DoNotOptimize(buffers.dst.data());
+        benchmark::ClobberMemory();
+    }
+}
+
+void run_c(benchmark::State &state, overhead_op_e op, overhead_buffers_t &buffers)
+{
+    std::uint32_t job_size = 0u;
+
+    if (dml_get_job_size(DML_PATH_SW, &job_size) != DML_STATUS_OK)
+    {
+        state.SkipWithError("overhead: dml_get_job_size failed");
+        return;
+    }
+
+    auto job_buffer = std::make_unique<std::uint8_t[]>(job_size);
+    auto job        = reinterpret_cast<dml_job_t *>(job_buffer.get());
+
+    if (dml_init_job(DML_PATH_SW, job) != DML_STATUS_OK)
+    {
+        state.SkipWithError("overhead: dml_init_job failed");
+        return;
+    }
+
+    const auto size = static_cast<std::uint32_t>(buffers.src.size());
+
+    switch (op)
+    {
+        case overhead_op_e::mem_move:
+            job->operation             = DML_OP_MEM_MOVE;
+            job->source_first_ptr      = buffers.src.data();
+            job->destination_first_ptr = buffers.dst.data();
+            job->source_length         = size;
+            break;
+        case overhead_op_e::fill:
+            job->operation             = DML_OP_FILL;
+            job->destination_first_ptr = buffers.dst.data();
+            job->destination_length    = size;
+            std::memcpy(job->pattern, &pattern, sizeof(pattern));
+            break;
+        case overhead_op_e::crc:
+            job->operation        = DML_OP_CRC;
+            job->source_first_ptr = buffers.src.data();
+            job->source_length    = size;
+            job->crc_checksum_ptr = &buffers.crc_value;
+            break;
+    }
+
+    for (auto _ : state)
+    {
+        if (dml_execute_job(job, DML_WAIT_MODE_BUSY_POLL) != DML_STATUS_OK)
+        {
+            state.SkipWithError("overhead: dml_execute_job failed");
+            break;
+        }
+
+        benchmark::DoNotOptimize(buffers.dst.data());
+        benchmark::ClobberMemory();
+    }
+
+    dml_finalize_job(job);
+}
+}
+
+BENCHMARK_SET_DELAYED(overhead)
+{
+    std::vector<size_t> sizes = (cmd::get_block_size() >= 0) ? std::vector<size_t>{(size_t)cmd::get_block_size()} : std::vector<size_t>{64, 128, 256, 512, 1024, 4096, 8192};
+
+    for (auto op : {overhead_op_e::mem_move, overhead_op_e::fill, overhead_op_e::crc})
+    {
+        for (auto size : sizes)
+        {
+            auto name    = format("overhead/op:%s/size:%zu", op_name(op), size);
+            auto buffers = std::make_shared<overhead_buffers_t>(size);
+
+            if (op != overhead_op_e::crc)
+            {
+                benchmark::RegisterBenchmark((name + "/api:memory").c_str(), [=](benchmark::State &state) {
+                    run_memory(state, op, *buffers);
+                    state.SetBytesProcessed(state.iterations() * size);
+                });
+            }
+
+            benchmark::RegisterBenchmark((name + "/api:cpp_execute").c_str(), [=](benchmark::State &state) {
+                run_cpp<true>(state, op, *buffers);
+                state.SetBytesProcessed(state.iterations() * size);
+            });
+
+            benchmark::RegisterBenchmark((name + "/api:cpp_submit").c_str(), [=](benchmark::State &state) {
+                run_cpp<false>(state, op, *buffers);
+                state.SetBytesProcessed(state.iterations() * size);
+            });
+
+            benchmark::RegisterBenchmark((name + "/api:c_execute").c_str(), [=](benchmark::State &state) {
+                run_c(state, op, *buffers);
+                state.SetBytesProcessed(state.iterations() * size);
+            });
+        }
+    }
+}
@@ -0,0 +1,204 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <benchmark/benchmark.h>
+
+#include <dml/dml.h>
+
+#include <hw_dispatcher.hpp>
+
+#include <utility.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+using namespace bench;
+
+namespace
+{
+// Several threads keep the hardware busy with small moves, so submissions compete for the work queues.
+// Reports submission latency percentiles, how often ENQCMD was rejected and how often a descriptor went to
+// a device on another NUMA node per submitted descriptor.
+constexpr std::uint32_t queue_depth = 32u;
+
+std::uint64_t total_retries()
+{
+    std::uint64_t retries = 0u;
+
+#if defined(__linux__)
+    auto &dispatcher = dml::core::dispatcher::hw_dispatcher::get_instance();
+
+    for (size_t device_idx = 0u; device_idx < dispatcher.device_count(); ++device_idx)
+    {
+        for (const auto &queue : dispatcher.device(device_idx))
+        {
+            retries += queue.retry_count();
+        }
+    }
+#endif
+
+    return retries;
+}
+
+std::uint64_t total_spillovers()
+{
+#if defined(__linux__)
+    return dml::core::dispatcher::hw_dispatcher::get_instance().spillover_count();
+#else
+    return 0u;
+#endif
+}
+
+struct submission_jobs_t
+{
+    explicit submission_jobs_t(size_t size): src(size * queue_depth, 7u), dst(size * queue_depth, 0u)
+    {
+    }
+
+    ~submission_jobs_t()
+    {
+        for (auto &buffer : buffers)
+        {
+            dml_finalize_job(reinterpret_cast<dml_job_t *>(buffer.get()));
+        }
+    }
+
+    std::vector<std::uint8_t>                   src;
+    std::vector<std::uint8_t>                   dst;
+    std::vector<std::unique_ptr<std::uint8_t[]>> buffers;
+    std::vector<dml_job_t *>                    jobs;
+};
+
+bool init_jobs(submission_jobs_t &jobs, size_t size)
+{
+    std::uint32_t job_size = 0u;
+
+    if (dml_get_job_size(DML_PATH_HW, &job_size) != DML_STATUS_OK)
+    {
+        return false;
+    }
+
+    for (std::uint32_t i = 0u; i < queue_depth; ++i)
+    {
+        jobs.buffers.push_back(std::make_unique<std::uint8_t[]>(job_size));
+
+        auto job = reinterpret_cast<dml_job_t *>(jobs.buffers.back().get());
+
+        if (dml_init_job(DML_PATH_HW, job) != DML_STATUS_OK)
+        {
+            jobs.buffers.pop_back();
+            return false;
+        }
+
+        job->operation             = DML_OP_MEM_MOVE;
+        job->source_first_ptr      = jobs.src.data() + i * size;
+        job->destination_first_ptr = jobs.dst.data() + i * size;
+        job->source_length         = static_cast<std::uint32_t>(size);
+
+        jobs.jobs.push_back(job);
+    }
+
+    return true;
+}
+
+void run_submission(benchmark::State &state, size_t size)
+{
+    auto jobs = submission_jobs_t(size);
+
+    if (!init_jobs(jobs, size))
+    {
+        state.SkipWithError("submission: hardware path is not available");
+        return;
+    }
+
+    std::vector<std::uint64_t> latencies;
+    std::uint64_t              queue_busy = 0u;
+    std::uint32_t              slot       = 0u;
+    std::uint32_t              in_flight  = 0u;
+
+    const auto retries_before    = (state.thread_index() == 0) ? total_retries() : 0u;
+    const auto spillovers_before = (state.thread_index() == 0) ? total_spillovers() : 0u;
+
+    for (auto _ : state)
+    {
+        auto job = jobs.jobs[slot];
+
+        if (in_flight == queue_depth)
+        {
+            dml_wait_job(job, DML_WAIT_MODE_BUSY_POLL);
+            --in_flight;
+        }
+
+        const auto start  = std::chrono::steady_clock::now();
+        const auto status = dml_submit_job(job);
+        const auto end    = std::chrono::steady_clock::now();
+
+        latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+
+        if (status == DML_STATUS_OK)
+        {
+            ++in_flight;
+            slot = (slot + 1u) % queue_depth;
+        }
+        else
+        {
+            ++queue_busy;
+        }
+    }
+
+    for (std::uint32_t i = 0u; i < in_flight; ++i)
+    {
+        dml_wait_job(jobs.jobs[(slot + queue_depth - in_flight + i) % queue_depth], DML_WAIT_MODE_BUSY_POLL);
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+
+    const auto percentile = [&latencies](size_t p) { return latencies.empty() ? 0.0 : double(latencies[(latencies.size() - 1u) * p / 100u]); };
+
+    state.counters["submit_p50_ns"] = benchmark::Counter(percentile(50u), benchmark::Counter::kAvgThreads);
+    state.counters["submit_p99_ns"] = benchmark::Counter(percentile(99u), benchmark::Counter::kAvgThreads);
+    state.counters["queue_busy"]    = benchmark::Counter(double(queue_busy));
+
+    // Retries and spillovers are counted by the library for all threads, so only the first thread reports them
+    const auto submissions        = double(state.iterations() * state.threads());
+    const auto retries            = (state.thread_index() == 0) ? double(total_retries() - retries_before) : 0.0;
+    const auto spillovers         = (state.thread_index() == 0) ? double(total_spillovers() - spillovers_before) : 0.0;
+    state.counters["retries/op"] = benchmark::Counter(submissions > 0.0 ? retries / submissions : 0.0);
+    state.counters["spills/op"]  = benchmark::Counter(submissions > 0.0 ? spillovers / submissions : 0.0);
+
+    state.SetBytesProcessed(state.iterations() * size);
+}
+}
+
+BENCHMARK_SET_DELAYED(submission)
+{
+    if (cmd::FLAGS_no_hw)
+        return;
+
+    std::vector<size_t> sizes = (cmd::get_block_size() >= 0) ? std::vector<size_t>{(size_t)cmd::get_block_size()} : std::vector<size_t>{256, 4096};
+
+    for (auto size : sizes)
+    {
+        auto name = format("submission/op:mem_move/size:%zu/path:hw", size);
+        auto b    = benchmark::RegisterBenchmark(name.c_str(), [=](benchmark::State &state) { run_submission(state, size); });
+
+        if (cmd::FLAGS_threads)
+        {
+            b->Threads(cmd::FLAGS_threads);
+        }
+        else
+        {
+            for (auto threads : {1, 2, 4, 8, 16})
+            {
+                b->Threads(threads);
+            }
+        }
+
+        b->UseRealTime();
+    }
+}
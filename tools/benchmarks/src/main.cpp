@@ -239,7 +239,7 @@ static void print_help()
             "                                          For accelerator this means number of concurrent submission threads\n"
             "                                          For CPU this means number of parallel executions\n"
             "                                          Each thread works on queue_size/threads operations\n"
-            "          [--node=<num>]                - force specific numa node for the task\n"
+            "          [--node=<num>]                - force specific numa node for the task, -2 - node of the task memory\n"
             "          [--in_mem=<location>]         - input memory location: def, l1, l2, llc, ram (default).\n"
             "          [--out_mem=<location>]        - output memory location: def, l1, l2, llc, ram and same with cc_ (cache control) prefix. Default: cc_def\n"
             "          [--full_time]                 - measure library specific task initialization and destruction\n"
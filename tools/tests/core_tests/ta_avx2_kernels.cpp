@@ -0,0 +1,245 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contain Algorithmic tests for the AVX2 kernels, which are checked against the reference ones
+ * @details Test list:
+ *          - @ref ta_avx2_mem_move
+ *          - @ref ta_avx2_fill
+ *          - @ref ta_avx2_compare
+ *          - @ref ta_avx2_compare_pattern
+ *          - @ref ta_avx2_create_delta
+ *          - @ref ta_avx2_dualcast
+ */
+
+#include <dml_cpuid.h>
+#include <dml_kernels.h>
+
+#include "t_common.hpp"
+#include "t_random_generator.hpp"
+#include "t_random_parameters.hpp"
+
+/** Sizes cover every tail length of the 32-byte and 128-byte loops */
+constexpr uint32_t AVX2_MAX_SIZE = 1024u + 160u;
+
+#define SKIP_IF_NO_AVX2()                                                                   \
+    if ((dml_core_cpuid(DML_CPUID_EXTENSIONS).ebx & DML_AVX2) != DML_AVX2)                 \
+    {                                                                                       \
+        GTEST_SKIP() << "AVX2 is not supported";                                            \
+    }
+
+/**
+ * @brief Returns a vector of the given size filled with random bytes
+ */
+static auto make_random_vector(dml::test::random_t<uint8_t> &random_filler, size_t size) -> std::vector<uint8_t>
+{
+    std::vector<uint8_t> result(size);
+
+    for (auto &value : result)
+    {
+        value = random_filler.get_next();
+    }
+
+    return result;
+}
+
+/**
+ * @brief Tests @ref dml_avx2_mem_move with separate and overlapping buffers
+ */
+auto ta_avx2_mem_move() -> void
+{
+    SKIP_IF_NO_AVX2();
+
+    dml::test::random_t<uint8_t> random_filler(test_system::get_seed());
+
+    for (uint32_t size = 0u; size < AVX2_MAX_SIZE; size += 7u)
+    {
+        for (int32_t shift : { -65, -33, -1, 0, 1, 33, 65, static_cast<int32_t>(AVX2_MAX_SIZE) })
+        {
+            const auto base   = make_random_vector(random_filler, AVX2_MAX_SIZE * 3u);
+            const auto offset = AVX2_MAX_SIZE;
+
+            auto actual    = base;
+            auto reference = base;
+
+            dml_avx2_mem_move(actual.data() + offset, actual.data() + offset + shift, size);
+            dml_ref_mem_move(reference.data() + offset, reference.data() + offset + shift, size);
+
+            ASSERT_EQ(actual, reference) << "size " << size << ", shift " << shift;
+        }
+    }
+}
+
+CORE_TEST_REGISTER(avx2_kernels, ta_avx2_mem_move);
+
+/**
+ * @brief Tests @ref dml_avx2_fill_u64 with different destination alignments
+ */
+auto ta_avx2_fill() -> void
+{
+    SKIP_IF_NO_AVX2();
+
+    constexpr uint64_t pattern = 0x0123456789ABCDEFu;
+
+    for (uint32_t size = 0u; size < AVX2_MAX_SIZE; size += 5u)
+    {
+        for (uint32_t alignment = 0u; alignment < 8u; ++alignment)
+        {
+            std::vector<uint8_t> actual(AVX2_MAX_SIZE + 8u, 0u);
+            std::vector<uint8_t> reference(AVX2_MAX_SIZE + 8u, 0u);
+
+            dml_avx2_fill_u64(pattern, actual.data() + alignment, size);
+            dml_ref_fill_u64(pattern, reference.data() + alignment, size);
+
+            ASSERT_EQ(actual, reference) << "size " << size << ", alignment " << alignment;
+        }
+    }
+}
+
+CORE_TEST_REGISTER(avx2_kernels, ta_avx2_fill);
+
+/**
+ * @brief Tests @ref dml_avx2_compare with a mismatch at every position
+ */
+auto ta_avx2_compare() -> void
+{
+    SKIP_IF_NO_AVX2();
+
+    dml::test::random_t<uint8_t> random_filler(test_system::get_seed());
+
+    for (uint32_t size = 1u; size < AVX2_MAX_SIZE; size += 11u)
+    {
+        const auto src1 = make_random_vector(random_filler, size);
+
+        for (uint32_t mismatch = 0u; mismatch <= size; mismatch += 3u)
+        {
+            auto src2 = src1;
+
+            if (mismatch < size)
+            {
+                src2[mismatch] ^= 0x10u;
+            }
+
+            uint8_t actual_result    = 0xFFu;
+            uint8_t reference_result = 0xFFu;
+
+            const auto actual    = dml_avx2_compare(src1.data(), src2.data(), size, &actual_result);
+            const auto reference = dml_ref_compare(src1.data(), src2.data(), size, &reference_result);
+
+            ASSERT_EQ(actual, reference) << "size " << size << ", mismatch " << mismatch;
+            ASSERT_EQ(actual_result, reference_result) << "size " << size << ", mismatch " << mismatch;
+        }
+    }
+}
+
+CORE_TEST_REGISTER(avx2_kernels, ta_avx2_compare);
+
+/**
+ * @brief Tests @ref dml_avx2_compare_pattern with a mismatch at every position
+ */
+auto ta_avx2_compare_pattern() -> void
+{
+    SKIP_IF_NO_AVX2();
+
+    constexpr uint64_t pattern = 0x0123456789ABCDEFu;
+
+    for (uint32_t size = 1u; size < AVX2_MAX_SIZE; size += 13u)
+    {
+        std::vector<uint8_t> src(size);
+        dml_ref_fill_u64(pattern, src.data(), size);
+
+        for (uint32_t mismatch = 0u; mismatch <= size; mismatch += 3u)
+        {
+            auto data = src;
+
+            if (mismatch < size)
+            {
+                data[mismatch] ^= 0x10u;
+            }
+
+            uint8_t actual_result    = 0xFFu;
+            uint8_t reference_result = 0xFFu;
+
+            const auto actual    = dml_avx2_compare_pattern(pattern, data.data(), size, &actual_result);
+            const auto reference = dml_ref_compare_pattern(pattern, data.data(), size, &reference_result);
+
+            ASSERT_EQ(actual, reference) << "size " << size << ", mismatch " << mismatch;
+            ASSERT_EQ(actual_result, reference_result) << "size " << size << ", mismatch " << mismatch;
+        }
+    }
+}
+
+CORE_TEST_REGISTER(avx2_kernels, ta_avx2_compare_pattern);
+
+/**
+ * @brief Tests @ref dml_avx2_create_delta including delta record overflow
+ */
+auto ta_avx2_create_delta() -> void
+{
+    SKIP_IF_NO_AVX2();
+
+    dml::test::random_t<uint8_t> random_filler(test_system::get_seed());
+
+    constexpr uint32_t note_size = 10u;
+
+    for (uint32_t size = 8u; size < AVX2_MAX_SIZE; size += 40u)
+    {
+        const auto src1 = make_random_vector(random_filler, size);
+        auto       src2 = src1;
+
+        // Every third block differs
+        for (uint32_t block = 0u; block < size / 8u; block += 3u)
+        {
+            src2[block * 8u + (block % 8u)] ^= 0x01u;
+        }
+
+        const auto block_count = size / 8u;
+
+        for (uint32_t max_size : { 0u, note_size * 2u, note_size * 2u + 1u, block_count * note_size })
+        {
+            std::vector<uint8_t> actual_record(block_count * note_size + note_size, 0u);
+            std::vector<uint8_t> reference_record(block_count * note_size + note_size, 0u);
+
+            uint8_t actual_result    = 0xFFu;
+            uint8_t reference_result = 0xFFu;
+
+            const auto actual = dml_avx2_create_delta(src1.data(), src2.data(), size, actual_record.data(), max_size, &actual_result);
+            const auto reference =
+                dml_ref_create_delta(src1.data(), src2.data(), size, reference_record.data(), max_size, &reference_result);
+
+            ASSERT_EQ(actual, reference) << "size " << size << ", max size " << max_size;
+            ASSERT_EQ(actual_result, reference_result) << "size " << size << ", max size " << max_size;
+            ASSERT_EQ(actual_record, reference_record) << "size " << size << ", max size " << max_size;
+        }
+    }
+}
+
+CORE_TEST_REGISTER(avx2_kernels, ta_avx2_create_delta);
+
+/**
+ * @brief Tests @ref dml_avx2_dualcast
+ */
+auto ta_avx2_dualcast() -> void
+{
+    SKIP_IF_NO_AVX2();
+
+    dml::test::random_t<uint8_t> random_filler(test_system::get_seed());
+
+    for (uint32_t size = 0u; size < AVX2_MAX_SIZE; size += 9u)
+    {
+        const auto src = make_random_vector(random_filler, size);
+
+        std::vector<uint8_t> dst1(size, 0u);
+        std::vector<uint8_t> dst2(size, 0u);
+
+        dml_avx2_dualcast(src.data(), dst1.data(), dst2.data(), size);
+
+        ASSERT_EQ(src, dst1) << "size " << size;
+        ASSERT_EQ(src, dst2) << "size " << size;
+    }
+}
+
+CORE_TEST_REGISTER(avx2_kernels, ta_avx2_dualcast);
@@ -0,0 +1,304 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contain Algorithmic tests for the AVX-512 kernels, which are checked against the reference ones
+ * @details Test list:
+ *          - @ref ta_avx512_create_delta
+ *          - @ref ta_avx512_apply_delta
+ *          - @ref ta_avx512_dualcast
+ *          - @ref ta_avx512_dualcast_nt
+ *          - @ref ta_avx512_mem_move_nt
+ *          - @ref ta_avx512_fill_nt
+ */
+
+#include <dml_cpuid.h>
+#include <dml_kernels.h>
+
+#include "t_common.hpp"
+#include "t_random_generator.hpp"
+#include "t_random_parameters.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+/** Sizes cover every tail length of the 64-byte loop */
+constexpr uint32_t AVX512_MAX_SIZE = 1024u + 160u;
+
+#define SKIP_IF_NO_AVX512()                                                                 \
+    if ((dml_core_cpuid(DML_CPUID_EXTENSIONS).ebx & DML_AVX512_MASK) != DML_AVX512_MASK)   \
+    {                                                                                       \
+        GTEST_SKIP() << "AVX-512 is not supported";                                         \
+    }
+
+/**
+ * @brief Tests @ref dml_avx512_create_delta with sparse and dense differences, including delta record overflow
+ */
+auto ta_avx512_create_delta() -> void
+{
+    SKIP_IF_NO_AVX512();
+
+    dml::test::random_t<uint8_t> random_filler(test_system::get_seed());
+
+    constexpr uint32_t note_size = 10u;
+
+    for (uint32_t size = 8u; size < AVX512_MAX_SIZE; size += 24u)
+    {
+        const auto block_count = size / 8u;
+
+        std::vector<uint8_t> src1(size);
+
+        for (auto &value : src1)
+        {
+            value = random_filler.get_next();
+        }
+
+        // Every block differs with the given step, a step of one makes all eight lanes of a vector differ
+        for (uint32_t step : { 1u, 3u, 7u })
+        {
+            auto src2 = src1;
+
+            for (uint32_t block = 0u; block < block_count; block += step)
+            {
+                src2[block * 8u + (block % 8u)] ^= 0x01u;
+            }
+
+            for (uint32_t max_size : { 0u, note_size * 2u, note_size * 2u + 1u, note_size * 9u + 3u, block_count * note_size })
+            {
+                std::vector<uint8_t> actual_record(block_count * note_size + note_size, 0u);
+                std::vector<uint8_t> reference_record(block_count * note_size + note_size, 0u);
+
+                uint8_t actual_result    = 0xFFu;
+                uint8_t reference_result = 0xFFu;
+
+                const auto actual =
+                    dml_avx512_create_delta(src1.data(), src2.data(), size, actual_record.data(), max_size, &actual_result);
+                const auto reference =
+                    dml_ref_create_delta(src1.data(), src2.data(), size, reference_record.data(), max_size, &reference_result);
+
+                ASSERT_EQ(actual, reference) << "size " << size << ", step " << step << ", max size " << max_size;
+                ASSERT_EQ(actual_result, reference_result) << "size " << size << ", step " << step << ", max size " << max_size;
+                ASSERT_EQ(actual_record, reference_record) << "size " << size << ", step " << step << ", max size " << max_size;
+            }
+        }
+
+        // Equal buffers produce no notes
+        std::vector<uint8_t> record(block_count * note_size, 0u);
+        uint8_t              result = 0xFFu;
+
+        ASSERT_EQ(dml_avx512_create_delta(src1.data(), src1.data(), size, record.data(), (uint32_t)record.size(), &result), 0u);
+        ASSERT_EQ(result, 0u);
+    }
+}
+
+CORE_TEST_REGISTER(avx512_kernels, ta_avx512_create_delta);
+
+/**
+ * @brief Tests @ref dml_avx512_apply_delta with runs of consecutive, unordered and repeated offsets
+ */
+auto ta_avx512_apply_delta() -> void
+{
+    SKIP_IF_NO_AVX512();
+
+    dml::test::random_t<uint8_t> random_filler(test_system::get_seed());
+
+    constexpr uint32_t note_size   = 10u;
+    constexpr uint32_t block_count = AVX512_MAX_SIZE / 8u;
+
+    for (uint32_t note_count = 0u; note_count < 80u; ++note_count)
+    {
+        std::vector<uint8_t> delta_record(note_count * note_size);
+
+        for (auto &value : delta_record)
+        {
+            value = random_filler.get_next();
+        }
+
+        // Offsets are consecutive, repeated or spread out depending on the count
+        for (uint32_t note = 0u; note < note_count; ++note)
+        {
+            uint16_t offset = 0u;
+
+            switch (note_count % 3u)
+            {
+                case 0u: offset = static_cast<uint16_t>(note_count % 5u + note); break;
+                case 1u: offset = static_cast<uint16_t>(random_filler.get_next() % (note_count % 7u + 1u) * 9u); break;
+                default: offset = static_cast<uint16_t>(note * (block_count / (note_count + 1u))); break;
+            }
+
+            std::memcpy(delta_record.data() + note * note_size, &offset, sizeof(offset));
+        }
+
+        std::vector<uint8_t> actual(block_count * 8u, 0u);
+        std::vector<uint8_t> reference(block_count * 8u, 0u);
+
+        dml_avx512_apply_delta(delta_record.data(), actual.data(), note_count * note_size);
+        dml_ref_apply_delta(delta_record.data(), reference.data(), note_count * note_size);
+
+        ASSERT_EQ(actual, reference) << "note count " << note_count;
+    }
+}
+
+CORE_TEST_REGISTER(avx512_kernels, ta_avx512_apply_delta);
+
+/**
+ * @brief Tests @ref dml_avx512_dualcast with destinations at the same and at different offsets in a line
+ */
+auto ta_avx512_dualcast() -> void
+{
+    SKIP_IF_NO_AVX512();
+
+    dml::test::random_t<uint8_t> random_filler(test_system::get_seed());
+
+    for (uint32_t size = 0u; size < AVX512_MAX_SIZE; size += 9u)
+    {
+        std::vector<uint8_t> src(size + 64u);
+
+        for (auto &value : src)
+        {
+            value = random_filler.get_next();
+        }
+
+        for (uint32_t alignment : { 0u, 3u, 63u })
+        {
+            for (uint32_t dst2_alignment : { alignment, (alignment + 8u) % 64u })
+            {
+                std::vector<uint8_t> dst1(size + 128u, 0u);
+                std::vector<uint8_t> dst2(size + 128u, 0u);
+
+                auto *dst1_begin = dst1.data() + (64u - reinterpret_cast<uintptr_t>(dst1.data()) % 64u) % 64u + alignment;
+                auto *dst2_begin = dst2.data() + (64u - reinterpret_cast<uintptr_t>(dst2.data()) % 64u) % 64u + dst2_alignment;
+
+                dml_avx512_dualcast(src.data() + alignment, dst1_begin, dst2_begin, size);
+
+                ASSERT_TRUE(std::equal(dst1_begin, dst1_begin + size, src.data() + alignment)) << "size " << size;
+                ASSERT_TRUE(std::equal(dst2_begin, dst2_begin + size, src.data() + alignment)) << "size " << size;
+                ASSERT_TRUE(std::all_of(dst1.data(), dst1_begin, [](auto value) { return value == 0u; }));
+                ASSERT_TRUE(std::all_of(dst2.data(), dst2_begin, [](auto value) { return value == 0u; }));
+                ASSERT_TRUE(std::all_of(dst1_begin + size, dst1.data() + dst1.size(), [](auto value) { return value == 0u; }));
+                ASSERT_TRUE(std::all_of(dst2_begin + size, dst2.data() + dst2.size(), [](auto value) { return value == 0u; }));
+            }
+        }
+    }
+}
+
+CORE_TEST_REGISTER(avx512_kernels, ta_avx512_dualcast);
+
+/**
+ * @brief Tests @ref dml_avx512_dualcast_nt with destinations at every offset in a line
+ */
+auto ta_avx512_dualcast_nt() -> void
+{
+    SKIP_IF_NO_AVX512();
+
+    dml::test::random_t<uint8_t> random_filler(test_system::get_seed());
+
+    for (uint32_t size = 0u; size < AVX512_MAX_SIZE; size += 13u)
+    {
+        std::vector<uint8_t> src(size + 64u);
+
+        for (auto &value : src)
+        {
+            value = random_filler.get_next();
+        }
+
+        for (uint32_t alignment : { 0u, 1u, 31u, 63u })
+        {
+            // Streaming stores are only used when both destinations share the offset in a line
+            for (uint32_t dst2_alignment : { alignment, (alignment + 8u) % 64u })
+            {
+                std::vector<uint8_t> dst1(size + 128u, 0u);
+                std::vector<uint8_t> dst2(size + 128u, 0u);
+
+                auto *dst1_begin = dst1.data() + (64u - reinterpret_cast<uintptr_t>(dst1.data()) % 64u) % 64u + alignment;
+                auto *dst2_begin = dst2.data() + (64u - reinterpret_cast<uintptr_t>(dst2.data()) % 64u) % 64u + dst2_alignment;
+
+                dml_avx512_dualcast_nt(src.data() + 3u, dst1_begin, dst2_begin, size);
+
+                ASSERT_TRUE(std::equal(dst1_begin, dst1_begin + size, src.data() + 3u)) << "size " << size << ", alignment " << alignment;
+                ASSERT_TRUE(std::equal(dst2_begin, dst2_begin + size, src.data() + 3u)) << "size " << size << ", alignment " << dst2_alignment;
+                ASSERT_TRUE(std::all_of(dst1.data(), dst1_begin, [](auto value) { return value == 0u; }));
+                ASSERT_TRUE(std::all_of(dst2.data(), dst2_begin, [](auto value) { return value == 0u; }));
+                ASSERT_TRUE(std::all_of(dst1_begin + size, dst1.data() + dst1.size(), [](auto value) { return value == 0u; }));
+                ASSERT_TRUE(std::all_of(dst2_begin + size, dst2.data() + dst2.size(), [](auto value) { return value == 0u; }));
+            }
+        }
+    }
+}
+
+CORE_TEST_REGISTER(avx512_kernels, ta_avx512_dualcast_nt);
+
+/**
+ * @brief Tests @ref dml_avx512_mem_move_nt with destinations at every offset in a line and with overlapping buffers
+ */
+auto ta_avx512_mem_move_nt() -> void
+{
+    SKIP_IF_NO_AVX512();
+
+    dml::test::random_t<uint8_t> random_filler(test_system::get_seed());
+
+    for (uint32_t size = 0u; size < AVX512_MAX_SIZE; size += 13u)
+    {
+        std::vector<uint8_t> src(size + 64u);
+
+        for (auto &value : src)
+        {
+            value = random_filler.get_next();
+        }
+
+        for (uint32_t alignment : { 0u, 1u, 31u, 63u })
+        {
+            std::vector<uint8_t> dst(size + 128u, 0u);
+
+            auto *dst_begin = dst.data() + (64u - reinterpret_cast<uintptr_t>(dst.data()) % 64u) % 64u + alignment;
+
+            dml_avx512_mem_move_nt(src.data() + 3u, dst_begin, size);
+
+            ASSERT_TRUE(std::equal(dst_begin, dst_begin + size, src.data() + 3u)) << "size " << size << ", alignment " << alignment;
+            ASSERT_TRUE(std::all_of(dst.data(), dst_begin, [](auto value) { return value == 0u; }));
+            ASSERT_TRUE(std::all_of(dst_begin + size, dst.data() + dst.size(), [](auto value) { return value == 0u; }));
+        }
+
+        // Overlapping buffers are moved with regular stores
+        auto reference = src;
+        auto actual    = src;
+
+        dml_ref_mem_move(reference.data(), reference.data() + 5u, size);
+        dml_avx512_mem_move_nt(actual.data(), actual.data() + 5u, size);
+
+        ASSERT_EQ(actual, reference) << "size " << size;
+    }
+}
+
+CORE_TEST_REGISTER(avx512_kernels, ta_avx512_mem_move_nt);
+
+/**
+ * @brief Tests @ref dml_avx512_fill_u64_nt against @ref dml_ref_fill_u64 with destinations at every offset in a line
+ */
+auto ta_avx512_fill_nt() -> void
+{
+    SKIP_IF_NO_AVX512();
+
+    constexpr uint64_t pattern = 0x0123456789ABCDEFu;
+
+    for (uint32_t size = 0u; size < AVX512_MAX_SIZE; size += 13u)
+    {
+        for (uint32_t alignment = 0u; alignment < 64u; alignment += 5u)
+        {
+            std::vector<uint8_t> actual(size + 128u, 0u);
+            std::vector<uint8_t> reference(size + 128u, 0u);
+
+            const auto offset = (64u - reinterpret_cast<uintptr_t>(actual.data()) % 64u) % 64u + alignment;
+
+            dml_avx512_fill_u64_nt(pattern, actual.data() + offset, size);
+            dml_ref_fill_u64(pattern, reference.data() + offset, size);
+
+            ASSERT_EQ(actual, reference) << "size " << size << ", alignment " << alignment;
+        }
+    }
+}
+
+CORE_TEST_REGISTER(avx512_kernels, ta_avx512_fill_nt);
@@ -17,6 +17,7 @@
 #include "t_random_generator.hpp"
 #include "t_random_parameters.hpp"
 
+#include <dml/detail/ml/direct.hpp>
 #include <optimization_dispatcher.hpp>
 
 
@@ -83,3 +84,25 @@ auto ta_dmlc_copy_cache_to_memory_run_without_errors() -> void
 }
 
 CORE_TEST_REGISTER(cache_features, ta_dmlc_copy_cache_to_memory_run_without_errors);
+
+
+/**
+ * @brief Tests that transfers executed directly never reach the size the software path writes with streaming stores
+ */
+auto ta_direct_transfers_stay_cached() -> void
+{
+    using dml::core::dispatch::is_non_temporal;
+    using dml::detail::ml::direct::is_applicable;
+
+    std::vector<uint8_t> vector(8192u);
+
+    ASSERT_TRUE(is_applicable(4095u, vector.data()));
+    ASSERT_FALSE(is_non_temporal(4095u, false));
+
+    ASSERT_FALSE(is_applicable(4096u, vector.data()));
+    ASSERT_TRUE(is_non_temporal(4096u, false));
+
+    ASSERT_FALSE(is_applicable(0u, vector.data()));
+}
+
+CORE_TEST_REGISTER(cache_features, ta_direct_transfers_stay_cached);
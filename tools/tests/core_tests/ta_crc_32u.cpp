@@ -41,3 +41,32 @@ auto ta_calculate_crc_32u_with_predefined_results() -> void
 }
 
 CORE_TEST_REGISTER(crc_32u, ta_calculate_crc_32u_with_predefined_results);
+
+/**
+ * @brief Tests that @ref dml::core::dispatch::crc_shift merges CRC of adjacent buffers
+ */
+auto ta_calculate_crc_32u_with_shift() -> void
+{
+    const std::string source = "123456789021345368-crc_test-12345";
+
+    const std::array<uint32_t, 4u> polynomials    = { 0x1EDC6F41, 0x04C11DB7, 0x8005, 0x1021 };
+    const std::array<uint32_t, 4u> initial_values = { 0x0000, 0xFFFFFFFF, 0x1D0F, 0x800D };
+
+    const auto data = reinterpret_cast<const uint8_t *>(source.data());
+    const auto size = static_cast<uint32_t>(source.size());
+
+    for (uint32_t i = 0u; i < polynomials.size(); i++)
+    {
+        const auto expected = dml::core::dispatch::crc(data, size, initial_values[i], polynomials[i]);
+
+        for (uint32_t split = 0u; split <= size; split++)
+        {
+            const auto head = dml::core::dispatch::crc(data, split, initial_values[i], polynomials[i]);
+            const auto tail = dml::core::dispatch::crc(data + split, size - split, 0u, polynomials[i]);
+
+            EXPECT_EQ(expected, dml::core::dispatch::crc_shift(head, size - split, polynomials[i]) ^ tail);
+        }
+    }
+}
+
+CORE_TEST_REGISTER(crc_32u, ta_calculate_crc_32u_with_shift);
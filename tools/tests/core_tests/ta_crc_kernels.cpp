@@ -0,0 +1,528 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contain Algorithmic tests for the CRC kernels, which are checked against a bitwise CRC
+ * @details Test list:
+ *          - @ref ta_ref_crc_kernels
+ *          - @ref ta_pclmul_crc_kernels
+ *          - @ref ta_pclmul_crc_many_polynomials
+ *          - @ref ta_ref_copy_crc_kernels
+ *          - @ref ta_pclmul_copy_crc_kernels
+ *          - @ref ta_avx512_copy_crc_kernels
+ *          - @ref ta_ref_crc16_t10_kernel
+ *          - @ref ta_pclmul_crc16_t10_kernel
+ *          - @ref ta_avx512_crc16_t10_kernel
+ *          - @ref ta_ref_copy_crc16_t10_kernel
+ *          - @ref ta_pclmul_copy_crc16_t10_kernel
+ *          - @ref ta_avx512_copy_crc16_t10_kernel
+ *          - @ref ta_ref_crc_multi_kernels
+ *          - @ref ta_pclmul_crc_multi_kernels
+ *          - @ref ta_avx512_crc_multi_kernels
+ */
+
+#include <dml_cpuid.h>
+#include <dml_kernels.h>
+
+#include "t_common.hpp"
+#include "t_random_generator.hpp"
+#include "t_random_parameters.hpp"
+
+#include <algorithm>
+#include <thread>
+
+/** Sizes cover the short and the folding paths of every kernel */
+constexpr uint32_t CRC_MAX_SIZE = 2048u + 64u;
+
+constexpr uint32_t crc_polynomials[] = { 0x1EDC6F41u, 0x04C11DB7u, 0x00008005u, 0x00001021u };
+
+constexpr uint32_t crc_seeds[] = { 0x00000000u, 0xFFFFFFFFu, 0x12345678u };
+
+#define SKIP_IF_NO_PCLMUL()                                                                         \
+    {                                                                                               \
+        const auto features = dml_core_cpuid(DML_CPUID_FEATURES);                                   \
+        if ((features.ecx & (DML_PCLMULQDQ | DML_SSE42)) != (DML_PCLMULQDQ | DML_SSE42))            \
+        {                                                                                           \
+            GTEST_SKIP() << "PCLMULQDQ is not supported";                                           \
+        }                                                                                           \
+    }
+
+#define SKIP_IF_NO_VPCLMUL()                                                                        \
+    {                                                                                               \
+        const auto registers = dml_core_cpuid(DML_CPUID_EXTENSIONS);                                \
+        if ((registers.ebx & DML_AVX512_MASK) != DML_AVX512_MASK ||                                 \
+            (registers.ecx & DML_VPCLMULQDQ) != DML_VPCLMULQDQ)                                     \
+        {                                                                                           \
+            GTEST_SKIP() << "VPCLMULQDQ is not supported";                                          \
+        }                                                                                           \
+    }
+
+using crc_kernel_t = uint32_t (*)(const uint8_t *, uint32_t, uint32_t, uint32_t);
+
+using copy_crc_kernel_t = uint32_t (*)(const uint8_t *, uint8_t *, uint32_t, uint32_t, uint32_t);
+
+/**
+ * @brief Bitwise CRC, the data is taken least significant bit first if reflected is set
+ */
+static auto bitwise_crc(const uint8_t *src, uint32_t size, uint32_t crc_value, uint32_t polynomial, bool reflected) -> uint32_t
+{
+    for (uint32_t byte = 0u; byte < size; ++byte)
+    {
+        for (uint32_t bit = 0u; bit < 8u; ++bit)
+        {
+            const uint32_t data_bit = reflected ? (src[byte] >> bit) & 1u : (src[byte] >> (7u - bit)) & 1u;
+            const uint32_t high_bit = (crc_value >> 31u) ^ data_bit;
+
+            crc_value = (crc_value << 1u) ^ (high_bit ? polynomial : 0u);
+        }
+    }
+
+    return crc_value;
+}
+
+/**
+ * @brief Checks the regular and the reflected kernels against @ref bitwise_crc
+ */
+static auto check_crc_kernels(crc_kernel_t crc_kernel, crc_kernel_t crc_reflected_kernel) -> void
+{
+    dml::test::random_t<uint8_t> random_filler(test_system::get_seed());
+
+    std::vector<uint8_t> src(CRC_MAX_SIZE);
+
+    for (auto &value : src)
+    {
+        value = random_filler.get_next();
+    }
+
+    for (auto polynomial : crc_polynomials)
+    {
+        for (auto seed : crc_seeds)
+        {
+            for (uint32_t size = 0u; size < CRC_MAX_SIZE; size += (size < 160u) ? 1u : 37u)
+            {
+                ASSERT_EQ(crc_kernel(src.data(), size, seed, polynomial), bitwise_crc(src.data(), size, seed, polynomial, false))
+                    << "polynomial " << polynomial << ", seed " << seed << ", size " << size;
+                ASSERT_EQ(crc_reflected_kernel(src.data(), size, seed, polynomial),
+                          bitwise_crc(src.data(), size, seed, polynomial, true))
+                    << "polynomial " << polynomial << ", seed " << seed << ", size " << size;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Tests @ref dml_ref_crc_32u and @ref dml_ref_crc_reflected_u32
+ */
+auto ta_ref_crc_kernels() -> void
+{
+    check_crc_kernels(dml_ref_crc_32u, dml_ref_crc_reflected_u32);
+}
+
+CORE_TEST_REGISTER(crc_kernels, ta_ref_crc_kernels);
+
+/**
+ * @brief Tests @ref dml_pclmul_crc_u32 and @ref dml_pclmul_crc_reflected_u32
+ */
+auto ta_pclmul_crc_kernels() -> void
+{
+    SKIP_IF_NO_PCLMUL();
+
+    check_crc_kernels(dml_pclmul_crc_u32, dml_pclmul_crc_reflected_u32);
+}
+
+CORE_TEST_REGISTER(crc_kernels, ta_pclmul_crc_kernels);
+
+/**
+ * @brief Tests @ref dml_pclmul_crc_u32 with more polynomials than folding constants are cached for, from several threads
+ */
+auto ta_pclmul_crc_many_polynomials() -> void
+{
+    SKIP_IF_NO_PCLMUL();
+
+    constexpr uint32_t thread_count     = 4u;
+    constexpr uint32_t polynomial_count = 48u;
+    constexpr uint32_t size             = 4096u;
+
+    dml::test::random_t<uint8_t> random_filler(test_system::get_seed());
+
+    std::vector<uint8_t> src(size);
+
+    for (auto &value : src)
+    {
+        value = random_filler.get_next();
+    }
+
+    std::vector<uint32_t> mismatches(thread_count, 0u);
+    std::vector<std::thread> threads;
+
+    for (uint32_t thread = 0u; thread < thread_count; ++thread)
+    {
+        threads.emplace_back([&, thread]() {
+            for (uint32_t round = 0u; round < 2u; ++round)
+            {
+                for (uint32_t i = 0u; i < polynomial_count; ++i)
+                {
+                    // Odd polynomials, every thread walks them in a different order
+                    const uint32_t polynomial = 0x04C11DB7u + 2u * ((i + thread * 7u) % polynomial_count);
+
+                    if (dml_pclmul_crc_u32(src.data(), size, 0xFFFFFFFFu, polynomial) !=
+                        bitwise_crc(src.data(), size, 0xFFFFFFFFu, polynomial, false))
+                    {
+                        ++mismatches[thread];
+                    }
+                }
+            }
+        });
+    }
+
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(mismatches, std::vector<uint32_t>(thread_count, 0u));
+}
+
+CORE_TEST_REGISTER(crc_kernels, ta_pclmul_crc_many_polynomials);
+
+/**
+ * @brief Checks that the copy CRC kernels copy the data and return the same CRC as @ref bitwise_crc
+ */
+static auto check_copy_crc_kernels(copy_crc_kernel_t copy_crc_kernel, copy_crc_kernel_t copy_crc_reflected_kernel) -> void
+{
+    // Sizes cross the 256-byte steps of the folding loops and leave tails of every length
+    constexpr uint32_t max_size = 4u * CRC_MAX_SIZE;
+
+    dml::test::random_t<uint8_t> random_filler(test_system::get_seed());
+
+    std::vector<uint8_t> src(max_size);
+
+    for (auto &value : src)
+    {
+        value = random_filler.get_next();
+    }
+
+    for (auto polynomial : crc_polynomials)
+    {
+        for (auto seed : crc_seeds)
+        {
+            for (uint32_t size = 0u; size < max_size; size += (size < 320u) ? 1u : 61u)
+            {
+                for (auto reflected : { false, true })
+                {
+                    std::vector<uint8_t> dst(size + 1u, 0u);
+
+                    const auto kernel = reflected ? copy_crc_reflected_kernel : copy_crc_kernel;
+
+                    ASSERT_EQ(kernel(src.data(), dst.data(), size, seed, polynomial), bitwise_crc(src.data(), size, seed, polynomial, reflected))
+                        << "polynomial " << polynomial << ", seed " << seed << ", size " << size << ", reflected " << reflected;
+                    ASSERT_TRUE(std::equal(src.begin(), src.begin() + size, dst.begin())) << "size " << size;
+                    ASSERT_EQ(dst[size], 0u) << "size " << size;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Tests @ref dml_ref_copy_crc_u32 and @ref dml_ref_copy_crc_reflected_u32
+ */
+auto ta_ref_copy_crc_kernels() -> void
+{
+    check_copy_crc_kernels(dml_ref_copy_crc_u32, dml_ref_copy_crc_reflected_u32);
+}
+
+CORE_TEST_REGISTER(crc_kernels, ta_ref_copy_crc_kernels);
+
+/**
+ * @brief Tests @ref dml_pclmul_copy_crc_u32 and @ref dml_pclmul_copy_crc_reflected_u32
+ */
+auto ta_pclmul_copy_crc_kernels() -> void
+{
+    SKIP_IF_NO_PCLMUL();
+
+    check_copy_crc_kernels(dml_pclmul_copy_crc_u32, dml_pclmul_copy_crc_reflected_u32);
+}
+
+CORE_TEST_REGISTER(crc_kernels, ta_pclmul_copy_crc_kernels);
+
+/**
+ * @brief Tests @ref dml_avx512_copy_crc_u32 and @ref dml_avx512_copy_crc_reflected_u32
+ */
+auto ta_avx512_copy_crc_kernels() -> void
+{
+    SKIP_IF_NO_PCLMUL();
+    SKIP_IF_NO_VPCLMUL();
+
+    check_copy_crc_kernels(dml_avx512_copy_crc_u32, dml_avx512_copy_crc_reflected_u32);
+}
+
+CORE_TEST_REGISTER(crc_kernels, ta_avx512_copy_crc_kernels);
+
+using crc16_t10_kernel_t = void (*)(const uint8_t *, uint32_t, uint32_t, uint32_t, uint16_t, uint16_t *);
+
+using copy_crc16_t10_kernel_t = void (*)(const uint8_t *, uint32_t, uint8_t *, uint32_t, uint32_t, uint32_t, uint16_t, uint16_t *);
+
+static constexpr uint32_t dif_tuple_size = 8u;
+
+static auto bitwise_crc16_t10(const uint8_t *src, uint32_t size, uint16_t seed) -> uint16_t
+{
+    constexpr uint16_t t10_polynomial = 0x8BB7u;
+
+    uint16_t crc = seed;
+
+    for (uint32_t byte = 0u; byte < size; ++byte)
+    {
+        crc ^= static_cast<uint16_t>(src[byte] << 8u);
+
+        for (uint32_t bit = 0u; bit < 8u; ++bit)
+        {
+            crc = (crc & 0x8000u) ? static_cast<uint16_t>((crc << 1u) ^ t10_polynomial) : static_cast<uint16_t>(crc << 1u);
+        }
+    }
+
+    return crc;
+}
+
+/**
+ * @brief Checks a T10 DIF CRC kernel against a bitwise 16-bit CRC for every DIF block size and odd block counts
+ */
+static auto check_crc16_t10_kernel(crc16_t10_kernel_t kernel) -> void
+{
+    dml::test::random_t<uint8_t> random_filler(test_system::get_seed());
+
+    for (uint32_t block_size : { 1u, 63u, 64u, 200u, 512u, 520u, 4096u, 4104u })
+    {
+        const uint32_t stride      = block_size + dif_tuple_size;
+        const uint32_t block_count = 11u;
+
+        std::vector<uint8_t> src(stride * block_count);
+
+        for (auto &value : src)
+        {
+            value = random_filler.get_next();
+        }
+
+        for (uint16_t seed : { 0x0000u, 0xFFFFu })
+        {
+            std::vector<uint16_t> crcs(block_count, 0u);
+
+            kernel(src.data(), block_size, stride, block_count, seed, crcs.data());
+
+            for (uint32_t block = 0u; block < block_count; ++block)
+            {
+                const auto crc = bitwise_crc16_t10(src.data() + block * stride, block_size, seed);
+
+                ASSERT_EQ(crcs[block], crc) << "block size " << block_size << ", seed " << seed << ", block " << block;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Tests @ref dml_ref_crc16_t10_blocks
+ */
+auto ta_ref_crc16_t10_kernel() -> void
+{
+    check_crc16_t10_kernel(dml_ref_crc16_t10_blocks);
+}
+
+CORE_TEST_REGISTER(crc_kernels, ta_ref_crc16_t10_kernel);
+
+/**
+ * @brief Tests @ref dml_pclmul_crc16_t10_blocks
+ */
+auto ta_pclmul_crc16_t10_kernel() -> void
+{
+    SKIP_IF_NO_PCLMUL();
+
+    check_crc16_t10_kernel(dml_pclmul_crc16_t10_blocks);
+}
+
+CORE_TEST_REGISTER(crc_kernels, ta_pclmul_crc16_t10_kernel);
+
+/**
+ * @brief Tests @ref dml_avx512_crc16_t10_blocks
+ */
+auto ta_avx512_crc16_t10_kernel() -> void
+{
+    SKIP_IF_NO_PCLMUL();
+    SKIP_IF_NO_VPCLMUL();
+
+    check_crc16_t10_kernel(dml_avx512_crc16_t10_blocks);
+}
+
+CORE_TEST_REGISTER(crc_kernels, ta_avx512_crc16_t10_kernel);
+
+/**
+ * @brief Checks a fused T10 DIF copy kernel, blocks are spread out in the source like for strip and in the destination like for insert
+ */
+static auto check_copy_crc16_t10_kernel(copy_crc16_t10_kernel_t kernel) -> void
+{
+    dml::test::random_t<uint8_t> random_filler(test_system::get_seed());
+
+    for (uint32_t block_size : { 1u, 63u, 64u, 200u, 512u, 520u, 4096u, 4104u })
+    {
+        for (uint32_t src_gap : { 0u, dif_tuple_size })
+        {
+            const uint32_t src_stride  = block_size + src_gap;
+            const uint32_t dst_stride  = block_size + (dif_tuple_size - src_gap);
+            const uint32_t block_count = 11u;
+
+            std::vector<uint8_t> src(src_stride * block_count);
+            std::vector<uint8_t> dst(dst_stride * block_count, 0u);
+            std::vector<uint8_t> reference(dst);
+
+            for (auto &value : src)
+            {
+                value = random_filler.get_next();
+            }
+
+            for (uint32_t block = 0u; block < block_count; ++block)
+            {
+                std::copy_n(src.data() + block * src_stride, block_size, reference.data() + block * dst_stride);
+            }
+
+            for (uint16_t seed : { 0x0000u, 0xFFFFu })
+            {
+                std::vector<uint16_t> crcs(block_count, 0u);
+
+                kernel(src.data(), src_stride, dst.data(), dst_stride, block_size, block_count, seed, crcs.data());
+
+                ASSERT_EQ(dst, reference) << "block size " << block_size << ", source gap " << src_gap;
+
+                for (uint32_t block = 0u; block < block_count; ++block)
+                {
+                    const auto crc = bitwise_crc16_t10(src.data() + block * src_stride, block_size, seed);
+
+                    ASSERT_EQ(crcs[block], crc) << "block size " << block_size << ", seed " << seed << ", block " << block;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Tests @ref dml_ref_copy_crc16_t10_blocks
+ */
+auto ta_ref_copy_crc16_t10_kernel() -> void
+{
+    check_copy_crc16_t10_kernel(dml_ref_copy_crc16_t10_blocks);
+}
+
+CORE_TEST_REGISTER(crc_kernels, ta_ref_copy_crc16_t10_kernel);
+
+/**
+ * @brief Tests @ref dml_pclmul_copy_crc16_t10_blocks
+ */
+auto ta_pclmul_copy_crc16_t10_kernel() -> void
+{
+    SKIP_IF_NO_PCLMUL();
+
+    check_copy_crc16_t10_kernel(dml_pclmul_copy_crc16_t10_blocks);
+}
+
+CORE_TEST_REGISTER(crc_kernels, ta_pclmul_copy_crc16_t10_kernel);
+
+/**
+ * @brief Tests @ref dml_avx512_copy_crc16_t10_blocks
+ */
+auto ta_avx512_copy_crc16_t10_kernel() -> void
+{
+    SKIP_IF_NO_PCLMUL();
+    SKIP_IF_NO_VPCLMUL();
+
+    check_copy_crc16_t10_kernel(dml_avx512_copy_crc16_t10_blocks);
+}
+
+CORE_TEST_REGISTER(crc_kernels, ta_avx512_copy_crc16_t10_kernel);
+
+using crc_multi_kernel_t = void (*)(const uint8_t *const *, const uint32_t *, uint32_t, uint32_t *, uint32_t);
+
+/**
+ * @brief Checks the multi-buffer kernels against @ref bitwise_crc for every buffer of a group
+ */
+static auto check_crc_multi_kernels(crc_multi_kernel_t crc_multi_kernel, crc_multi_kernel_t crc_multi_reflected_kernel) -> void
+{
+    // Groups are not a multiple of the interleaved buffers count and have buffers of unequal sizes
+    constexpr uint32_t max_count = 13u;
+
+    dml::test::random_t<uint8_t>  random_filler(test_system::get_seed());
+    dml::test::random_t<uint32_t> random_size(test_system::get_seed());
+
+    std::vector<uint8_t> src(max_count * CRC_MAX_SIZE);
+
+    for (auto &value : src)
+    {
+        value = random_filler.get_next();
+    }
+
+    for (auto polynomial : crc_polynomials)
+    {
+        for (uint32_t count = 0u; count <= max_count; ++count)
+        {
+            for (auto reflected : { false, true })
+            {
+                std::vector<const uint8_t *> srcs(count);
+                std::vector<uint32_t>        sizes(count);
+                std::vector<uint32_t>        crcs(count);
+
+                for (uint32_t i = 0u; i < count; ++i)
+                {
+                    srcs[i]  = src.data() + i * CRC_MAX_SIZE;
+                    sizes[i] = random_size.get_next() % CRC_MAX_SIZE;
+                    crcs[i]  = crc_seeds[i % std::size(crc_seeds)];
+                }
+
+                const auto kernel = reflected ? crc_multi_reflected_kernel : crc_multi_kernel;
+
+                kernel(srcs.data(), sizes.data(), count, crcs.data(), polynomial);
+
+                for (uint32_t i = 0u; i < count; ++i)
+                {
+                    ASSERT_EQ(crcs[i], bitwise_crc(srcs[i], sizes[i], crc_seeds[i % std::size(crc_seeds)], polynomial, reflected))
+                        << "polynomial " << polynomial << ", count " << count << ", buffer " << i << ", size " << sizes[i]
+                        << ", reflected " << reflected;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief Tests @ref dml_ref_crc_multi_u32 and @ref dml_ref_crc_multi_reflected_u32
+ */
+auto ta_ref_crc_multi_kernels() -> void
+{
+    check_crc_multi_kernels(dml_ref_crc_multi_u32, dml_ref_crc_multi_reflected_u32);
+}
+
+CORE_TEST_REGISTER(crc_kernels, ta_ref_crc_multi_kernels);
+
+/**
+ * @brief Tests @ref dml_pclmul_crc_multi_u32 and @ref dml_pclmul_crc_multi_reflected_u32
+ */
+auto ta_pclmul_crc_multi_kernels() -> void
+{
+    SKIP_IF_NO_PCLMUL();
+
+    check_crc_multi_kernels(dml_pclmul_crc_multi_u32, dml_pclmul_crc_multi_reflected_u32);
+}
+
+CORE_TEST_REGISTER(crc_kernels, ta_pclmul_crc_multi_kernels);
+
+/**
+ * @brief Tests @ref dml_avx512_crc_multi_u32 and @ref dml_avx512_crc_multi_reflected_u32
+ */
+auto ta_avx512_crc_multi_kernels() -> void
+{
+    SKIP_IF_NO_PCLMUL();
+    SKIP_IF_NO_VPCLMUL();
+
+    check_crc_multi_kernels(dml_avx512_crc_multi_u32, dml_avx512_crc_multi_reflected_u32);
+}
+
+CORE_TEST_REGISTER(crc_kernels, ta_avx512_crc_multi_kernels);
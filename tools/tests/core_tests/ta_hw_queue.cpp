@@ -0,0 +1,244 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains tests for submission to dedicated work queues
+ * @details Portal of the queue is a page of regular memory, so descriptors written with MOVDIR64B can be checked
+ */
+
+#include "t_common.hpp"
+
+#if defined(__linux__)
+
+#include <hw_queue.hpp>
+#include <sys/mman.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using dml::core::dispatcher::hw_queue;
+
+    constexpr uint32_t portal_size = 0x1000u;
+
+    struct alignas(64) test_descriptor_t
+    {
+        dsahw_descriptor_t descriptor;
+    };
+
+    struct alignas(32) test_record_t
+    {
+        dsahw_completion_record_t record;
+    };
+
+    void *map_portal()
+    {
+        return mmap(nullptr, portal_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    }
+
+    /**
+     * @brief Checks that the portal is not mapped anymore
+     */
+    void assert_unmapped(void *portal_ptr)
+    {
+        unsigned char residency = 0u;
+
+        ASSERT_NE(mincore(portal_ptr, portal_size, &residency), 0);
+        ASSERT_EQ(errno, ENOMEM);
+    }
+
+    void set_record(test_descriptor_t &dsc, test_record_t &record)
+    {
+        const auto address = reinterpret_cast<uint64_t>(&record.record);
+
+        std::memcpy(dsc.descriptor.bytes + 8u, &address, sizeof(address));
+    }
+}  // namespace
+
+/**
+ * @brief Tests that a dedicated queue accepts as many descriptors as its size and takes new ones as they complete
+ */
+auto ta_hw_queue_dedicated() -> void
+{
+    constexpr uint32_t size = 4u;
+
+    auto *portal_ptr = map_portal();
+    ASSERT_NE(portal_ptr, MAP_FAILED);
+
+    {
+        auto queue = hw_queue();
+
+        if (DML_STATUS_OK != queue.configure(portal_ptr, hw_queue::submission_mode::dedicated, size, 0))
+        {
+            munmap(portal_ptr, portal_size);
+            GTEST_SKIP() << "MOVDIR64B is not supported";
+        }
+
+        ASSERT_EQ(queue.mode(), hw_queue::submission_mode::dedicated);
+        ASSERT_EQ(queue.credits(), size);
+
+        auto descriptors = std::vector<test_descriptor_t>(size + 2u);
+        auto records     = std::vector<test_record_t>(size + 2u);
+
+        for (uint32_t i = 0u; i < descriptors.size(); ++i)
+        {
+            std::memset(descriptors[i].descriptor.bytes, static_cast<int>(i + 1u), sizeof(dsahw_descriptor_t));
+            std::memset(&records[i], 0, sizeof(test_record_t));
+            set_record(descriptors[i], records[i]);
+        }
+
+        const auto *portal_bytes = reinterpret_cast<const uint8_t *>(portal_ptr);
+
+        // Every descriptor lands in the next 64 bytes of the portal
+        for (uint32_t i = 0u; i < size; ++i)
+        {
+            ASSERT_EQ(queue.enqueue_descriptor(&descriptors[i].descriptor), DML_STATUS_OK);
+            ASSERT_EQ(std::memcmp(portal_bytes + i * 64u, &descriptors[i].descriptor, sizeof(dsahw_descriptor_t)), 0);
+        }
+
+        ASSERT_EQ(queue.credits(), 0u);
+
+        // Queue is full until a completed descriptor is released, the record itself is not looked at
+        records[1].record.status = 1u;
+
+        ASSERT_EQ(queue.enqueue_descriptor(&descriptors[size].descriptor), DML_STATUS_WORK_QUEUE_OVERFLOW_ERROR);
+        ASSERT_EQ(queue.retry_count(), 1u);
+
+        ASSERT_TRUE(queue.release_credit(&records[1].record));
+        ASSERT_EQ(queue.credits(), 1u);
+
+        // Records that are not in flight, or were released already, change nothing
+        ASSERT_FALSE(queue.release_credit(&records[1].record));
+        ASSERT_FALSE(queue.release_credit(&records[size + 1u].record));
+        ASSERT_EQ(queue.credits(), 1u);
+
+        // The slot a descriptor went to releases its credit directly, other records in it are kept
+        uint32_t slot = hw_queue::max_dedicated_size;
+
+        ASSERT_EQ(queue.enqueue_dedicated(&descriptors[size].descriptor, slot), DML_STATUS_OK);
+        ASSERT_LT(slot, size);
+        ASSERT_EQ(std::memcmp(portal_bytes + size * 64u, &descriptors[size].descriptor, sizeof(dsahw_descriptor_t)), 0);
+        ASSERT_EQ(queue.credits(), 0u);
+
+        ASSERT_FALSE(queue.release_credit(&records[0].record, slot));
+        ASSERT_FALSE(queue.release_credit(&records[size].record, size));
+        ASSERT_TRUE(queue.release_credit(&records[size].record, slot));
+        ASSERT_EQ(queue.credits(), 1u);
+
+        // Records can be freed once released, so all credits come back
+        for (uint32_t i = 0u; i < size; ++i)
+        {
+            queue.release_credit(&records[i].record);
+        }
+
+        ASSERT_EQ(queue.credits(), size);
+    }
+
+    // A configured queue unmaps its portal when it is destroyed
+    assert_unmapped(portal_ptr);
+}
+
+/**
+ * @brief Tests that a dedicated queue is not overflowed by concurrent submitters
+ */
+auto ta_hw_queue_dedicated_threads() -> void
+{
+    constexpr uint32_t size               = 2u;
+    constexpr uint32_t thread_count       = 4u;
+    constexpr uint32_t submissions_count  = 1000u;
+
+    auto *portal_ptr = map_portal();
+    ASSERT_NE(portal_ptr, MAP_FAILED);
+
+    {
+        auto queue = hw_queue();
+
+        if (DML_STATUS_OK != queue.configure(portal_ptr, hw_queue::submission_mode::dedicated, size, 0))
+        {
+            munmap(portal_ptr, portal_size);
+            GTEST_SKIP() << "MOVDIR64B is not supported";
+        }
+
+        auto accepted = std::atomic<uint32_t>(0u);
+        auto threads  = std::vector<std::thread>();
+
+        for (uint32_t t = 0u; t < thread_count; ++t)
+        {
+            threads.emplace_back([&queue, &accepted]() {
+                test_descriptor_t dsc;
+                test_record_t     record;
+
+                std::memset(&dsc, 0, sizeof(dsc));
+                std::memset(&record, 0, sizeof(record));
+                set_record(dsc, record);
+
+                for (uint32_t i = 0u; i < submissions_count;)
+                {
+                    // Completion is seen right away, so the credit is released after every submission
+                    uint32_t slot = 0u;
+                    if (DML_STATUS_OK == queue.enqueue_dedicated(&dsc.descriptor, slot))
+                    {
+                        queue.release_credit(&record.record, slot);
+                        accepted.fetch_add(1u);
+                        ++i;
+                    }
+                }
+            });
+        }
+
+        for (auto &thread : threads)
+        {
+            thread.join();
+        }
+
+        ASSERT_EQ(accepted.load(), thread_count * submissions_count);
+        ASSERT_EQ(queue.credits(), size);
+    }
+
+    // A configured queue unmaps its portal when it is destroyed
+    assert_unmapped(portal_ptr);
+}
+
+/**
+ * @brief Tests the limits of dedicated queue configuration
+ */
+auto ta_hw_queue_configure() -> void
+{
+    auto *portal_ptr = map_portal();
+    ASSERT_NE(portal_ptr, MAP_FAILED);
+
+    {
+        auto queue = hw_queue();
+
+        if (DML_STATUS_OK != queue.configure(portal_ptr, hw_queue::submission_mode::dedicated, 1u, 0))
+        {
+            munmap(portal_ptr, portal_size);
+            GTEST_SKIP() << "MOVDIR64B is not supported";
+        }
+
+        ASSERT_NE(queue.configure(portal_ptr, hw_queue::submission_mode::dedicated, 0u, 0), DML_STATUS_OK);
+        ASSERT_NE(queue.configure(portal_ptr, hw_queue::submission_mode::dedicated, hw_queue::max_dedicated_size + 1u, 0), DML_STATUS_OK);
+        ASSERT_EQ(queue.configure(portal_ptr, hw_queue::submission_mode::dedicated, hw_queue::max_dedicated_size, 7), DML_STATUS_OK);
+        ASSERT_EQ(queue.priority(), 7);
+        ASSERT_EQ(queue.credits(), hw_queue::max_dedicated_size);
+
+        ASSERT_EQ(queue.configure(portal_ptr, hw_queue::submission_mode::shared, 0u, 0), DML_STATUS_OK);
+        ASSERT_EQ(queue.mode(), hw_queue::submission_mode::shared);
+    }
+
+    // A configured queue unmaps its portal when it is destroyed
+    assert_unmapped(portal_ptr);
+}
+
+CORE_TEST_REGISTER(hw_queue, ta_hw_queue_dedicated);
+CORE_TEST_REGISTER(hw_queue, ta_hw_queue_dedicated_threads);
+CORE_TEST_REGISTER(hw_queue, ta_hw_queue_configure);
+
+#endif
@@ -0,0 +1,274 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains tests for simulated devices
+ * @details Descriptors are submitted through a queue in the simulated mode, the way the hardware path does it
+ */
+
+#include "t_common.hpp"
+
+#if defined(__linux__)
+
+#include <core/completion_record_views.hpp>
+#include <core/descriptor_views.hpp>
+#include <core/device.hpp>
+#include <core/operations.hpp>
+#include <core/view.hpp>
+#include <dml/detail/common/flags.hpp>
+#include <dml/detail/common/status.hpp>
+#include <hw_queue.hpp>
+#include <hw_simulator.hpp>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    using dml::core::dispatcher::hw_queue;
+    using dml::core::dispatcher::simulated_device;
+    using dml::core::dispatcher::simulation_config;
+    using dml::core::operation;
+    using dml::detail::execution_status;
+    using dml::detail::flag;
+    using dml::detail::to_underlying;
+
+    constexpr auto page_fault_status = to_underlying(execution_status::page_fault_during_processing);
+    constexpr auto success_status    = to_underlying(execution_status::success);
+
+    auto make_config() -> simulation_config
+    {
+        auto config       = simulation_config();
+        config.queues     = 1u;
+        config.engines    = 1u;
+        config.latency_ns = 0u;
+        config.bandwidth  = 0.0;
+
+        return config;
+    }
+
+    auto make_descriptor(operation op, const void *src, void *dst, uint32_t size, dml::core::completion_record &record, bool block_on_fault = false)
+        -> dml::core::descriptor
+    {
+        auto dsc  = dml::core::descriptor();
+        auto view = dml::core::any_descriptor(dsc);
+
+        view.operation()                 = to_underlying(op);
+        view.flags()                     = to_underlying(flag::completion_record_address_valid) | to_underlying(flag::request_completion_record) |
+                                           (block_on_fault ? to_underlying(flag::block_on_fault) : 0u);
+        view.completion_record_address() = reinterpret_cast<uint64_t>(&record);
+        view.source_address()            = reinterpret_cast<uint64_t>(src);
+        view.destination_address()       = reinterpret_cast<uint64_t>(dst);
+        view.transfer_size()             = size;
+
+        return dsc;
+    }
+
+    auto submit(const hw_queue &queue, const dml::core::descriptor &dsc) -> dsahw_status_t
+    {
+        return queue.enqueue_descriptor(reinterpret_cast<const dsahw_descriptor_t *>(&dsc));
+    }
+
+    auto wait(const dml::core::completion_record &record) -> uint8_t
+    {
+        const volatile auto &status = record.bytes[0];
+
+        while (0u == status)
+        {
+            std::this_thread::yield();
+        }
+
+        return status;
+    }
+
+    void configure(hw_queue &queue, simulated_device &device)
+    {
+        auto &portal = device.portal(0u);
+
+        ASSERT_EQ(queue.configure(&portal, hw_queue::submission_mode::simulated, portal.size(), 0), DML_STATUS_OK);
+    }
+}  // namespace
+
+/**
+ * @brief Tests that a descriptor is executed and its completion record is written after the latency
+ */
+auto ta_hw_simulator_latency() -> void
+{
+    constexpr uint32_t size = 4096u;
+
+    auto config       = make_config();
+    config.latency_ns = 20000000u;
+
+    auto device = simulated_device(config, 0u);
+    auto queue  = hw_queue();
+    configure(queue, device);
+
+    auto src    = std::vector<uint8_t>(size, 5u);
+    auto dst    = std::vector<uint8_t>(size, 0u);
+    auto record = dml::core::completion_record();
+    auto dsc    = make_descriptor(operation::mem_move, src.data(), dst.data(), size, record);
+
+    const auto start = std::chrono::steady_clock::now();
+
+    ASSERT_EQ(submit(queue, dsc), DML_STATUS_OK);
+    ASSERT_EQ(record.bytes[0], 0u);
+    ASSERT_EQ(wait(record), success_status);
+
+    ASSERT_GE(std::chrono::steady_clock::now() - start, std::chrono::nanoseconds(config.latency_ns));
+    ASSERT_EQ(src, dst);
+}
+
+/**
+ * @brief Tests that a full queue and injected retries reject submissions
+ */
+auto ta_hw_simulator_retry() -> void
+{
+    auto config       = make_config();
+    config.queue_size = 2u;
+    config.latency_ns = 20000000u;
+
+    auto src     = std::vector<uint8_t>(64u, 1u);
+    auto dst     = std::vector<uint8_t>(64u, 0u);
+    auto records = std::vector<dml::core::completion_record>(8u);
+
+    {
+        auto device = simulated_device(config, 0u);
+        auto queue  = hw_queue();
+        configure(queue, device);
+
+        // Engine takes one descriptor out of the queue while it waits for the latency
+        auto accepted = 0u;
+        while (accepted < records.size() &&
+               DML_STATUS_OK == submit(queue, make_descriptor(operation::mem_move, src.data(), dst.data(), 64u, records[accepted])))
+        {
+            ++accepted;
+        }
+
+        ASSERT_GE(accepted, config.queue_size);
+        ASSERT_LE(accepted, config.queue_size + config.engines);
+        ASSERT_EQ(queue.retry_count(), 1u);
+
+        for (auto i = 0u; i < accepted; ++i)
+        {
+            ASSERT_EQ(wait(records[i]), success_status);
+        }
+    }
+
+    config.retry_rate = 1.0;
+
+    auto device = simulated_device(config, 0u);
+    auto queue  = hw_queue();
+    configure(queue, device);
+
+    for (auto i = 0u; i < 4u; ++i)
+    {
+        ASSERT_EQ(submit(queue, make_descriptor(operation::mem_move, src.data(), dst.data(), 64u, records[0])),
+                  DML_STATUS_WORK_QUEUE_OVERFLOW_ERROR);
+    }
+
+    ASSERT_EQ(queue.retry_count(), 4u);
+}
+
+/**
+ * @brief Tests that injected page faults complete the first half of a transfer, unless the descriptor blocks on fault
+ */
+auto ta_hw_simulator_injected_page_fault() -> void
+{
+    constexpr uint32_t size = 4096u;
+
+    auto config            = make_config();
+    config.page_fault_rate = 1.0;
+
+    auto device = simulated_device(config, 0u);
+    auto queue  = hw_queue();
+    configure(queue, device);
+
+    auto src    = std::vector<uint8_t>(size);
+    auto dst    = std::vector<uint8_t>(size, 0u);
+    auto record = dml::core::completion_record();
+
+    for (uint32_t i = 0u; i < size; ++i)
+    {
+        src[i] = static_cast<uint8_t>(i * 7u);
+    }
+
+    ASSERT_EQ(submit(queue, make_descriptor(operation::mem_move, src.data(), dst.data(), size, record)), DML_STATUS_OK);
+    ASSERT_EQ(wait(record), page_fault_status);
+
+    auto fault_record = dml::core::any_completion_record(record);
+    ASSERT_EQ(fault_record.bytes_completed(), size / 2u);
+    ASSERT_EQ(fault_record.fault_address(), reinterpret_cast<uint64_t>(src.data() + size / 2u));
+    ASSERT_EQ(std::memcmp(src.data(), dst.data(), size / 2u), 0);
+    ASSERT_EQ(dst[size / 2u], 0u);
+
+    // CRC of the rest, seeded with the partial one, is the CRC of the whole buffer
+    auto crc_record   = dml::core::completion_record();
+    auto whole_record = dml::core::completion_record();
+    auto rest_record  = dml::core::completion_record();
+
+    ASSERT_EQ(submit(queue, make_descriptor(operation::crc, src.data(), nullptr, size, crc_record)), DML_STATUS_OK);
+    ASSERT_EQ(wait(crc_record), page_fault_status);
+
+    auto partial = dml::core::make_view<operation::crc>(crc_record);
+    auto rest    = make_descriptor(operation::crc, src.data() + partial.bytes_completed(), nullptr, size - partial.bytes_completed(), rest_record);
+    dml::core::make_view<operation::crc>(rest).crc_seed() = partial.crc_value();
+
+    static_cast<void>(dml::core::software_device().execute(rest));
+    static_cast<void>(dml::core::software_device().execute(make_descriptor(operation::crc, src.data(), nullptr, size, whole_record)));
+
+    ASSERT_EQ(dml::core::make_view<operation::crc>(rest_record).crc_value(), dml::core::make_view<operation::crc>(whole_record).crc_value());
+
+    // Blocking descriptors are never faulted
+    std::memset(&record, 0, sizeof(record));
+    ASSERT_EQ(submit(queue, make_descriptor(operation::mem_move, src.data(), dst.data(), size, record, true)), DML_STATUS_OK);
+    ASSERT_EQ(wait(record), success_status);
+    ASSERT_EQ(src, dst);
+}
+
+/**
+ * @brief Tests that a page which is not resident faults a descriptor that does not block on fault
+ */
+auto ta_hw_simulator_non_resident_page() -> void
+{
+    const auto page_size  = static_cast<uint32_t>(getpagesize());
+    const auto size       = page_size * 4u;
+    const auto fault_page = 2u;
+
+    auto device = simulated_device(make_config(), 0u);
+    auto queue  = hw_queue();
+    configure(queue, device);
+
+    auto *src = static_cast<uint8_t *>(mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    ASSERT_NE(src, MAP_FAILED);
+
+    auto dst    = std::vector<uint8_t>(size, 0u);
+    auto record = dml::core::completion_record();
+
+    std::memset(src, 3, size);
+    madvise(src + page_size * fault_page, page_size, MADV_DONTNEED);
+
+    ASSERT_EQ(submit(queue, make_descriptor(operation::mem_move, src, dst.data(), size, record)), DML_STATUS_OK);
+    ASSERT_EQ(wait(record), page_fault_status);
+    ASSERT_EQ(dml::core::any_completion_record(record).bytes_completed(), page_size * fault_page);
+    ASSERT_EQ(dml::core::any_completion_record(record).fault_address(), reinterpret_cast<uint64_t>(src + page_size * fault_page));
+
+    std::memset(&record, 0, sizeof(record));
+    ASSERT_EQ(submit(queue, make_descriptor(operation::mem_move, src, dst.data(), size, record, true)), DML_STATUS_OK);
+    ASSERT_EQ(wait(record), success_status);
+    ASSERT_EQ(std::memcmp(src, dst.data(), size), 0);
+
+    munmap(src, size);
+}
+
+CORE_TEST_REGISTER(hw_simulator, ta_hw_simulator_latency);
+CORE_TEST_REGISTER(hw_simulator, ta_hw_simulator_retry);
+CORE_TEST_REGISTER(hw_simulator, ta_hw_simulator_injected_page_fault);
+CORE_TEST_REGISTER(hw_simulator, ta_hw_simulator_non_resident_page);
+
+#endif
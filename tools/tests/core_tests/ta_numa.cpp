@@ -0,0 +1,131 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains tests for the NUMA node a descriptor is submitted to
+ */
+
+#include "t_common.hpp"
+
+#if defined(__linux__)
+
+#include <core/descriptor_views.hpp>
+#include <core/operations.hpp>
+#include <core/view.hpp>
+#include <dml/detail/common/utils/enum.hpp>
+#include <numa.hpp>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+    using dml::core::operation;
+    using dml::core::util::current_numa_id;
+    using dml::core::util::data_numa_id;
+
+    auto make_descriptor(operation op, const void *src, void *dst) -> dml::core::descriptor
+    {
+        auto dsc  = dml::core::descriptor();
+        auto view = dml::core::any_descriptor(dsc);
+
+        view.operation()           = dml::detail::to_underlying(op);
+        view.source_address()      = reinterpret_cast<uint64_t>(src);
+        view.destination_address() = reinterpret_cast<uint64_t>(dst);
+
+        return dsc;
+    }
+}  // namespace
+
+/**
+ * @brief Tests that resident memory has a node and memory that is not resident yet is unknown
+ */
+auto ta_numa_memory_node() -> void
+{
+    const auto page_size = static_cast<size_t>(getpagesize());
+
+    auto *memory = static_cast<uint8_t *>(mmap(nullptr, page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    ASSERT_NE(memory, MAP_FAILED);
+
+    ASSERT_EQ(dml::core::util::get_memory_numa_id(memory), current_numa_id);
+
+    // move_pages may be forbidden in containers, the node is unknown then
+    auto       resident = std::vector<uint8_t>(page_size, 1u);
+    const auto numa_id  = dml::core::util::get_memory_numa_id(resident.data());
+
+    if (numa_id != current_numa_id)
+    {
+        ASSERT_EQ(access(("/sys/devices/system/node/node" + std::to_string(numa_id)).c_str(), F_OK), 0);
+
+        // Unknown node is not kept for long, the page gets its node soon after it is written
+        memory[0] = 1u;
+
+        auto memory_numa_id = current_numa_id;
+
+        for (uint32_t i = 0u; i < 64u && memory_numa_id == current_numa_id; ++i)
+        {
+            memory_numa_id = dml::core::util::get_memory_numa_id(memory);
+        }
+
+        ASSERT_NE(memory_numa_id, current_numa_id);
+    }
+
+    munmap(memory, page_size);
+}
+
+/**
+ * @brief Tests that descriptors resolve to the node of their data, and to the submitter node without data
+ */
+auto ta_numa_resolve() -> void
+{
+    auto src = std::vector<uint8_t>(64u, 1u);
+    auto dst = std::vector<uint8_t>(64u, 0u);
+
+    const auto own_numa_id = dml::core::util::get_numa_id();
+    const auto src_numa_id = dml::core::util::get_memory_numa_id(src.data());
+    const auto dst_numa_id = dml::core::util::get_memory_numa_id(dst.data());
+
+    const auto expected = [own_numa_id](uint32_t numa_id) { return (numa_id == current_numa_id) ? own_numa_id : numa_id; };
+
+    const auto move = make_descriptor(operation::mem_move, src.data(), dst.data());
+    const auto crc  = make_descriptor(operation::crc, src.data(), nullptr);
+    const auto nop  = make_descriptor(operation::nop, nullptr, nullptr);
+
+    ASSERT_EQ(dml::core::util::resolve_numa_id(move, 3u), 3u);
+    ASSERT_EQ(dml::core::util::resolve_numa_id(move, current_numa_id), own_numa_id);
+    ASSERT_EQ(dml::core::util::resolve_numa_id(move, data_numa_id), expected(dst_numa_id));
+    ASSERT_EQ(dml::core::util::resolve_numa_id(crc, data_numa_id), expected(src_numa_id));
+    ASSERT_EQ(dml::core::util::resolve_numa_id(nop, data_numa_id), own_numa_id);
+
+    // A batch goes where its first descriptor goes
+    const auto batch = make_descriptor(operation::batch, &move, nullptr);
+    ASSERT_EQ(dml::core::util::resolve_numa_id(batch, data_numa_id), expected(dst_numa_id));
+}
+
+/**
+ * @brief Tests that node files are read for every node sysfs describes
+ */
+auto ta_numa_node_files() -> void
+{
+    const auto distances = dml::core::util::read_numa_node_files("distance");
+
+    for (uint32_t id = 0u; id < distances.size(); ++id)
+    {
+        ASSERT_EQ(access(("/sys/devices/system/node/node" + std::to_string(id)).c_str(), F_OK), 0);
+        ASSERT_FALSE(distances[id].empty());
+    }
+
+    ASSERT_NE(access(("/sys/devices/system/node/node" + std::to_string(distances.size())).c_str(), F_OK), 0);
+    ASSERT_TRUE(dml::core::util::read_numa_node_files("no_such_file").empty());
+}
+
+CORE_TEST_REGISTER(numa, ta_numa_memory_node);
+CORE_TEST_REGISTER(numa, ta_numa_node_files);
+CORE_TEST_REGISTER(numa, ta_numa_resolve);
+
+#endif
@@ -0,0 +1,86 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains tests for the order devices are tried in by placement policies
+ */
+
+#include "t_common.hpp"
+
+#if defined(__linux__)
+
+#include <placement.hpp>
+
+#include <vector>
+
+namespace
+{
+    using dml::core::dispatcher::placement;
+
+    // Node 0 is close to node 1 and far from node 2
+    auto make_placement(placement::policy policy) -> placement
+    {
+        return placement(policy, 2u, {{10u, 12u, 30u}, {12u, 10u, 30u}, {30u, 30u, 10u}});
+    }
+
+    auto order(const placement &devices_placement, const std::vector<placement::device_state> &devices, size_t first = 0u)
+        -> std::vector<uint32_t>
+    {
+        auto result = std::vector<uint32_t>(devices.size());
+        result.resize(devices_placement.order(0u, devices.data(), devices.size(), first, result.data()));
+
+        return result;
+    }
+}  // namespace
+
+/**
+ * @brief Tests that the local policy takes devices on the node of the submitter only
+ */
+auto ta_placement_local() -> void
+{
+    const auto devices = std::vector<placement::device_state>{{2u, 0u}, {0u, 5u}, {1u, 0u}, {0u, 3u}, {0u, 3u}};
+    const auto local   = make_placement(placement::policy::local);
+
+    ASSERT_EQ(order(local, devices), (std::vector<uint32_t>{3u, 4u, 1u}));
+    ASSERT_EQ(order(local, devices, 4u), (std::vector<uint32_t>{4u, 3u, 1u}));
+}
+
+/**
+ * @brief Tests that the spill policy takes local devices first, then remote ones from the nearest node
+ */
+auto ta_placement_spill() -> void
+{
+    const auto devices = std::vector<placement::device_state>{{2u, 0u}, {0u, 5u}, {1u, 7u}, {0u, 3u}, {1u, 1u}};
+    const auto spill   = make_placement(placement::policy::spill);
+
+    ASSERT_EQ(spill.spill_retries(), 2u);
+    ASSERT_EQ(order(spill, devices), (std::vector<uint32_t>{3u, 1u, 4u, 2u, 0u}));
+}
+
+/**
+ * @brief Tests that the weighted policy trades load against distance
+ */
+auto ta_placement_weighted() -> void
+{
+    const auto weighted = make_placement(placement::policy::weighted);
+
+    // Distance 12 costs 32 of load, distance 30 costs 320
+    const auto busy = std::vector<placement::device_state>{{2u, 0u}, {0u, 40u}, {1u, 0u}};
+    ASSERT_EQ(order(weighted, busy), (std::vector<uint32_t>{2u, 1u, 0u}));
+
+    const auto idle = std::vector<placement::device_state>{{2u, 0u}, {0u, 20u}, {1u, 0u}};
+    ASSERT_EQ(order(weighted, idle), (std::vector<uint32_t>{1u, 2u, 0u}));
+
+    // Unknown nodes are at the distance of a neighbor socket
+    ASSERT_EQ(weighted.distance(0u, 5u), 20u);
+    ASSERT_EQ(weighted.distance(5u, 5u), placement::local_distance);
+}
+
+CORE_TEST_REGISTER(placement, ta_placement_local);
+CORE_TEST_REGISTER(placement, ta_placement_spill);
+CORE_TEST_REGISTER(placement, ta_placement_weighted);
+
+#endif
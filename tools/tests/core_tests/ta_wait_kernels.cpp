@@ -0,0 +1,69 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+/**
+ * @brief Contains algorithmic tests for the adaptive wait
+ * @details The completion byte is written by another thread while the tested thread spins, sleeps or yields
+ */
+
+#include "t_common.hpp"
+
+#include <dml_kernels.h>
+#include <optimization_dispatcher.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+    template <typename wait_t>
+    void check_wait(std::chrono::microseconds delay, wait_t &&wait)
+    {
+        alignas(64) volatile uint8_t byte = 0u;
+
+        auto writer = std::thread([&byte, delay]() {
+            std::this_thread::sleep_for(delay);
+            byte = 1u;
+        });
+
+        wait(&byte);
+
+        ASSERT_EQ(static_cast<uint8_t>(byte), 1u);
+
+        writer.join();
+    }
+}  // namespace
+
+/**
+ * @brief Tests the adaptive wait with a completion that comes before and long after the expected time
+ */
+auto ta_wait_adaptive() -> void
+{
+    alignas(64) volatile uint8_t done = 1u;
+
+    auto estimate = dml::core::dispatch::wait_estimate();
+    auto other    = dml::core::dispatch::wait_estimate();
+
+    // Completed already
+    dml_wait_adaptive(&done, 0u);
+    dml::core::dispatch::wait_adaptive(&done, 0u, estimate);
+
+    for (auto delay : {std::chrono::microseconds(0), std::chrono::microseconds(100), std::chrono::microseconds(2000)})
+    {
+        // Expected time much shorter than the delay, so the wait ends up yielding
+        check_wait(delay, [](const volatile uint8_t *pointer) { dml_wait_adaptive(pointer, 1000u); });
+
+        // Dispatched version, which uses umwait if the CPU supports it
+        check_wait(delay, [&estimate](const volatile uint8_t *pointer) { dml::core::dispatch::wait_adaptive(pointer, 16u * 1024u * 1024u, estimate); });
+        check_wait(delay, [&estimate](const volatile uint8_t *pointer) { dml::core::dispatch::wait_adaptive(pointer, 64u, estimate); });
+    }
+
+    // Calibration stays with the executor that was waited for
+    ASSERT_EQ(other.cycles_per_kb.load(), 64u);
+}
+
+CORE_TEST_REGISTER(wait_kernels, ta_wait_adaptive);
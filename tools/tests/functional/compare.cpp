@@ -25,7 +25,7 @@ namespace// anonymous
 
     struct variable
     {
-        static constexpr std::uint32_t transfer_size[] = {1, 3, 8, 15, 64, 255, 1024};
+        static constexpr std::uint32_t transfer_size[] = {1, 3, 8, 15, 64, 255, 1024, 1048579};
         static constexpr std::uint32_t src1_alignment[] = {1, 2, 4, 8};
         static constexpr std::uint32_t src2_alignment[] = {1, 2, 4, 8};
         static constexpr expect_e expect[] = {expect_e::none, expect_e::equal, expect_e::not_equal};
@@ -24,7 +24,7 @@ namespace// anonymous
 
     struct variable
     {
-        static constexpr std::uint32_t transfer_size[] = {1, 3, 8, 15, 64, 255, 1024};
+        static constexpr std::uint32_t transfer_size[] = {1, 3, 8, 15, 64, 255, 1024, 1048579};
         static constexpr std::uint32_t src_alignment[] = {1, 2, 4, 8};
         static constexpr reflection_e reflection[] = {reflection_e::enable, reflection_e::disable};
         static constexpr data_reflection_e data_reflection[] = {data_reflection_e::enable, data_reflection_e::disable};
@@ -22,7 +22,7 @@ namespace// anonymous
 
     struct variable
     {
-        static constexpr std::uint32_t transfer_size[] = { 1, 3, 8, 15, 64, 255, 1024 };
+        static constexpr std::uint32_t transfer_size[] = { 1, 3, 8, 15, 64, 255, 1024, 1048579 };
         static constexpr std::uint32_t dst_alignment[] = {1, 2, 4, 8};
         #if !defined(SW_PATH) && defined(__linux__)
         static constexpr block_on_fault_e block_on_fault[] = {block_on_fault_e::dont_block, block_on_fault_e::block};
@@ -25,7 +25,7 @@ namespace// anonymous
 
     struct variable
     {
-        static constexpr std::uint32_t transfer_size[] = {1, 3, 8, 15, 64, 255, 1024};
+        static constexpr std::uint32_t transfer_size[] = {1, 3, 8, 15, 64, 255, 1024, 1048579};
         static constexpr std::uint32_t src_alignment[] = {1, 2, 4, 8};
         static constexpr std::uint32_t dst_alignment[] = {1, 2, 4, 8};
         static constexpr std::int32_t offset[] = {-4, -1, 0, +1, +4};
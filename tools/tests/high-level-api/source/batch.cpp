@@ -120,6 +120,138 @@ TYPED_TEST(dmlhl_batch, fence)
     ASSERT_EQ(src, dst);
 }
 
+TEST(dmlhl_batch, software_stops_at_first_failure)
+{
+    constexpr auto length = 4096u;
+    constexpr auto count  = 16u;
+    constexpr auto failed = 9u;
+
+    auto src   = std::vector<uint8_t>(length * count, 7u);
+    auto dst   = std::vector<uint8_t>(length * count, 0u);
+    auto other = std::vector<uint8_t>(length, 8u);
+
+    auto sequence = dml::sequence(count, std::allocator<dml::byte_t>());
+
+    for (auto i = 0u; i < count; ++i)
+    {
+        auto src_view = dml::make_view(src.data() + i * length, length);
+        auto dst_view = dml::make_view(dst.data() + i * length, length);
+
+        if (i == failed)
+        {
+            ASSERT_EQ(sequence.add(dml::compare.expect_equal(), src_view, dml::make_view(other)), dml::status_code::ok);
+        }
+        else if (i == failed + 3u)
+        {
+            ASSERT_EQ(sequence.add(dml::nop), dml::status_code::ok);
+        }
+        else
+        {
+            ASSERT_EQ(sequence.add(dml::mem_move, src_view, dst_view), dml::status_code::ok);
+        }
+    }
+
+    auto result = dml::execute<dml::software>(dml::batch, sequence);
+
+    ASSERT_NE(result.status, dml::status_code::ok);
+    ASSERT_EQ(result.operations_completed, failed);
+    ASSERT_TRUE(std::equal(src.begin(), src.begin() + failed * length, dst.begin()));
+
+    // Entries after the next fence are never started
+    ASSERT_TRUE(std::all_of(dst.begin() + (failed + 3u) * length, dst.end(), [](auto value) { return value == 0u; }));
+}
+
+TEST(dmlhl_batch, software_fenced_segments_keep_order)
+{
+    constexpr auto length = 4096u;
+    constexpr auto parts  = 6u;
+    constexpr auto count  = parts * 3u + 2u;
+
+    auto first  = std::vector<uint8_t>(length * parts, 0u);
+    auto second = std::vector<uint8_t>(length * parts, 0u);
+    auto third  = std::vector<uint8_t>(length * parts, 0u);
+
+    auto sequence = dml::sequence(count, std::allocator<dml::byte_t>());
+
+    // Every segment reads what the previous one wrote, so it only passes if segments run one after another
+    for (auto i = 0u; i < parts; ++i)
+    {
+        ASSERT_EQ(sequence.add(dml::fill, uint64_t(i + 1u) * 0x0101010101010101u, dml::make_view(first.data() + i * length, length)), dml::status_code::ok);
+    }
+
+    ASSERT_EQ(sequence.add(dml::nop), dml::status_code::ok);
+
+    for (auto i = 0u; i < parts; ++i)
+    {
+        ASSERT_EQ(sequence.add(dml::mem_move, dml::make_view(first.data() + i * length, length), dml::make_view(second.data() + i * length, length)),
+                  dml::status_code::ok);
+    }
+
+    ASSERT_EQ(sequence.add(dml::nop), dml::status_code::ok);
+
+    for (auto i = 0u; i < parts; ++i)
+    {
+        ASSERT_EQ(sequence.add(dml::mem_move, dml::make_view(second.data() + i * length, length), dml::make_view(third.data() + i * length, length)),
+                  dml::status_code::ok);
+    }
+
+    auto result = dml::execute<dml::software>(dml::batch, sequence);
+
+    ASSERT_EQ(result.status, dml::status_code::ok);
+    ASSERT_EQ(result.operations_completed, count);
+
+    for (auto i = 0u; i < parts; ++i)
+    {
+        ASSERT_TRUE(std::all_of(third.begin() + i * length, third.begin() + (i + 1u) * length, [i](auto value) { return value == i + 1u; }));
+    }
+
+    ASSERT_EQ(first, third);
+}
+
+TEST(dmlhl_batch, software_failure_in_later_segment)
+{
+    constexpr auto length = 4096u;
+    constexpr auto parts  = 5u;
+    constexpr auto failed = parts + 3u;
+    constexpr auto count  = parts * 3u + 2u;
+
+    auto src   = std::vector<uint8_t>(length * count, 7u);
+    auto dst   = std::vector<uint8_t>(length * count, 0u);
+    auto other = std::vector<uint8_t>(length, 8u);
+
+    auto sequence = dml::sequence(count, std::allocator<dml::byte_t>());
+
+    // Segments are split by the nops at parts and 2 * parts + 1, the failure is in the middle one
+    for (auto i = 0u; i < count; ++i)
+    {
+        auto src_view = dml::make_view(src.data() + i * length, length);
+        auto dst_view = dml::make_view(dst.data() + i * length, length);
+
+        if (i == parts || i == parts * 2u + 1u)
+        {
+            ASSERT_EQ(sequence.add(dml::nop), dml::status_code::ok);
+        }
+        else if (i == failed)
+        {
+            ASSERT_EQ(sequence.add(dml::compare.expect_equal(), src_view, dml::make_view(other)), dml::status_code::ok);
+        }
+        else
+        {
+            ASSERT_EQ(sequence.add(dml::mem_move, src_view, dst_view), dml::status_code::ok);
+        }
+    }
+
+    auto result = dml::execute<dml::software>(dml::batch, sequence);
+
+    ASSERT_NE(result.status, dml::status_code::ok);
+    ASSERT_EQ(result.operations_completed, failed);
+
+    // The first segment and the entries before the failure are complete, nothing after the next fence is started
+    ASSERT_TRUE(std::equal(src.begin(), src.begin() + parts * length, dst.begin()));
+    ASSERT_TRUE(std::equal(src.begin() + (parts + 1u) * length, src.begin() + failed * length, dst.begin() + (parts + 1u) * length));
+    ASSERT_TRUE(std::all_of(dst.begin() + (parts * 2u + 1u) * length, dst.end(), [](auto value) { return value == 0u; }));
+}
+
 TYPED_TEST(dmlhl_batch, bad_length_0)
 {
     constexpr auto length = 16u;
@@ -153,6 +153,98 @@ TYPED_TEST(dmlhl_crc, all_flags) {
     }
 }
 
+TYPED_TEST(dmlhl_crc, multiple_buffers) {
+    SKIP_IF_WRONG_PATH(typename TestFixture::execution_path);
+
+    const auto seed = test_system::get_seed();
+
+    for (uint32_t count : {1u, 3u, 4u, 7u, 64u, 100u}) {
+        std::vector<dml::testing::crc> data;
+        std::vector<dml::crc_buffer>   buffers;
+        std::vector<uint32_t>          crc_values(count);
+
+        data.reserve(count);
+
+        for (uint32_t i = 0; i < count; i++) {
+            // Unequal lengths, some of them shorter than a SIMD register
+            data.emplace_back(seed + i, 1u + (i * 331u) % 4096u);
+            data[i].crc_seed = i * 0x9E3779B9u;
+            buffers.push_back({data[i].src.data(), data[i].length, data[i].crc_seed});
+        }
+
+        for (auto bypass_data_reflection : {false, true}) {
+            auto operation = bypass_data_reflection ? dml::crc.bypass_data_reflection() : dml::crc;
+
+            auto result = dml::execute<typename TestFixture::execution_path>(
+                    operation, buffers.data(), count, crc_values.data());
+
+            ASSERT_EQ(result.status, dml::status_code::ok) << "count " << count;
+
+            for (uint32_t i = 0; i < count; i++) {
+                const auto ref = bypass_data_reflection
+                                 ? dml::reference::calculate_crc<uint32_t, DML_FLAG_CRC_READ_SEED | DML_FLAG_CRC_BYPASS_DATA_REFLECTION>(
+                                         data[i].src.data(), data[i].src.data() + data[i].length, data[i].crc_seed)
+                                 : dml::reference::calculate_crc<uint32_t, DML_FLAG_CRC_READ_SEED>(
+                                         data[i].src.data(), data[i].src.data() + data[i].length, data[i].crc_seed);
+
+                ASSERT_EQ(crc_values[i], ref) << "count " << count << ", buffer " << i;
+            }
+        }
+    }
+}
+
+TYPED_TEST(dmlhl_crc, combine) {
+    SKIP_IF_WRONG_PATH(typename TestFixture::execution_path);
+
+    constexpr auto length = 4096u;
+    const auto     seed   = test_system::get_seed();
+
+    auto test_data = dml::testing::crc(seed, length);
+    test_data.crc_seed = seed * 0x9E3779B9u;
+
+    for (auto operation : {dml::crc, dml::crc.bypass_reflection()}) {
+        auto whole = dml::execute<typename TestFixture::execution_path>(
+                operation, dml::make_view(test_data.src.data(), length), test_data.crc_seed);
+
+        ASSERT_EQ(whole.status, dml::status_code::ok);
+
+        for (uint32_t split : {1u, 63u, 64u, 1000u, 4095u}) {
+            auto head = dml::execute<typename TestFixture::execution_path>(
+                    operation, dml::make_view(test_data.src.data(), split), test_data.crc_seed);
+            auto tail = dml::execute<typename TestFixture::execution_path>(
+                    operation, dml::make_view(test_data.src.data() + split, length - split), 0u);
+
+            ASSERT_EQ(head.status, dml::status_code::ok);
+            ASSERT_EQ(tail.status, dml::status_code::ok);
+
+            ASSERT_EQ(dml::crc_combine(operation, head.crc_value, tail.crc_value, length - split), whole.crc_value)
+                    << "split " << split;
+        }
+    }
+}
+
+TYPED_TEST(dmlhl_crc, parallel) {
+    SKIP_IF_WRONG_PATH(typename TestFixture::execution_path);
+
+    const auto seed     = test_system::get_seed();
+    const auto crc_seed = seed * 0x9E3779B9u;
+
+    for (uint32_t length : {16u, 1000u, 65536u + 17u}) {
+        auto test_data = dml::testing::crc(seed, length);
+
+        for (size_t chunk_count : {1u, 3u, 8u}) {
+            auto result = dml::parallel_crc<typename TestFixture::execution_path>(
+                    dml::crc, dml::make_view(test_data.src.data(), length), crc_seed, chunk_count);
+
+            const auto ref = dml::reference::calculate_crc<uint32_t, DML_FLAG_CRC_READ_SEED>(
+                    test_data.src.data(), test_data.src.data() + length, crc_seed);
+
+            ASSERT_EQ(result.status, dml::status_code::ok) << "length " << length << ", chunks " << chunk_count;
+            ASSERT_EQ(result.crc_value, ref) << "length " << length << ", chunks " << chunk_count;
+        }
+    }
+}
+
 TYPED_TEST(dmlhl_crc, src_null) {
     constexpr auto length = 16u;
     const auto     seed   = test_system::get_seed();;
@@ -4,6 +4,9 @@
  * SPDX-License-Identifier: MIT
  ******************************************************************************/
 
+#include <cstring>
+#include <deque>
+
 #include "gtest/gtest.h"
 
 #include <dml_test_utils/mem_move.hpp>
@@ -76,6 +79,92 @@ TYPED_TEST(dmlhl_mem_move, success) {
     }
 }
 
+TYPED_TEST(dmlhl_mem_move, overlapping_small) {
+    SKIP_IF_WRONG_PATH(typename TestFixture::execution_path);
+
+    const auto seed = test_system::get_seed();
+
+    // Sizes around the largest transfer the software path executes without a descriptor
+    for (uint32_t size : {1u, 63u, 64u, 511u, 4095u, 4096u, 4097u}) {
+        for (uint32_t shift : {1u, 8u, 63u}) {
+            for (auto forward : {true, false}) {
+                auto test_data = dml::testing::mem_move(seed, size + shift);
+
+                std::vector<uint8_t> reference(test_data.src.begin(), test_data.src.end());
+
+                auto *src = test_data.src.data() + (forward ? 0u : shift);
+                auto *dst = test_data.src.data() + (forward ? shift : 0u);
+
+                std::memmove(reference.data() + (dst - test_data.src.data()), reference.data() + (src - test_data.src.data()), size);
+
+                auto result = this->run(dml::mem_move, dml::make_view(src, size), dml::make_view(dst, size));
+
+                ASSERT_EQ(result.status, dml::status_code::ok) << "size " << size << ", shift " << shift;
+                ASSERT_TRUE(std::equal(reference.begin(), reference.end(), test_data.src.begin()))
+                        << "size " << size << ", shift " << shift << ", forward " << forward;
+            }
+        }
+    }
+}
+
+TYPED_TEST(dmlhl_mem_move, wait_modes) {
+    SKIP_IF_WRONG_PATH(typename TestFixture::execution_path);
+
+    constexpr auto size = 256u * 1024u;
+    const auto     seed = test_system::get_seed();
+
+    for (auto mode : {dml::wait_mode::busy_poll, dml::wait_mode::umwait, dml::wait_mode::adaptive}) {
+        auto test_data = dml::testing::mem_move(seed, size);
+
+        auto handler = dml::submit<typename TestFixture::execution_path>(dml::mem_move,
+                                                                         dml::make_view(test_data.src),
+                                                                         dml::make_view(test_data.dst));
+
+        ASSERT_EQ(handler.get(mode).status, dml::status_code::ok);
+        ASSERT_TRUE(test_data.check());
+    }
+}
+
+TYPED_TEST(dmlhl_mem_move, handler_group) {
+    SKIP_IF_WRONG_PATH(typename TestFixture::execution_path);
+
+    constexpr auto size  = 64u * 1024u;
+    constexpr auto count = 4u;
+    const auto     seed  = test_system::get_seed();
+
+    for (auto mode : {dml::wait_mode::busy_poll, dml::wait_mode::umwait, dml::wait_mode::adaptive}) {
+        auto test_data = std::deque<dml::testing::mem_move>();
+        auto group     = dml::handler_group<dml::mem_move_operation>();
+
+        for (auto i = 0u; i < count; ++i) {
+            test_data.emplace_back(seed + i, size);
+        }
+
+        for (auto &data : test_data) {
+            group.add(dml::submit<typename TestFixture::execution_path>(dml::mem_move,
+                                                                        dml::make_view(data.src),
+                                                                        dml::make_view(data.dst)));
+        }
+
+        const auto index = group.wait_any(mode);
+
+        ASSERT_LT(index, group.size());
+        ASSERT_EQ(group[index].get().status, dml::status_code::ok);
+        ASSERT_TRUE(test_data[index].check());
+
+        group.wait_all(mode);
+
+        for (auto finished : group.finished_mask()) {
+            ASSERT_TRUE(finished);
+        }
+
+        for (auto i = 0u; i < count; ++i) {
+            ASSERT_EQ(group[i].get().status, dml::status_code::ok);
+            ASSERT_TRUE(test_data[i].check());
+        }
+    }
+}
+
 TYPED_TEST(dmlhl_mem_move, src_null) {
     constexpr auto size = 16u;
     constexpr auto seed = 777u;
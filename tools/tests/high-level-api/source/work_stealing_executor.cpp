@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include "gtest/gtest.h"
+
+#include <dml/dml.hpp>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+TEST(dmlhl_work_stealing_executor, runs_all_tasks)
+{
+    constexpr auto task_count = 10000u;
+
+    auto counter = std::atomic<std::uint32_t>(0u);
+
+    {
+        auto executor = dml::work_stealing_executor(4u, 16u);
+
+        ASSERT_EQ(executor.thread_count(), 4u);
+
+        for (auto i = 0u; i < task_count; ++i)
+        {
+            executor([&counter]() { counter.fetch_add(1u); });
+        }
+    }
+
+    // Destruction of the last executor copy completes queued tasks
+    ASSERT_EQ(counter.load(), task_count);
+}
+
+TEST(dmlhl_work_stealing_executor, nested_submission)
+{
+    constexpr auto outer_count = 64u;
+    constexpr auto inner_count = 64u;
+
+    auto counter = std::atomic<std::uint32_t>(0u);
+
+    {
+        auto executor = dml::work_stealing_executor(2u, 8u);
+
+        for (auto i = 0u; i < outer_count; ++i)
+        {
+            executor([&counter, &executor]() {
+                for (auto j = 0u; j < inner_count; ++j)
+                {
+                    executor([&counter]() { counter.fetch_add(1u); });
+                }
+            });
+        }
+
+        while (counter.load() != outer_count * inner_count)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    ASSERT_EQ(counter.load(), outer_count * inner_count);
+}
+
+TEST(dmlhl_work_stealing_executor, move_only_task)
+{
+    auto value = std::make_unique<int>(42);
+    auto done  = std::atomic<int>(0);
+
+    {
+        auto executor = dml::work_stealing_executor(1u);
+
+        executor([moved = std::move(value), &done]() { done.store(*moved); });
+    }
+
+    ASSERT_EQ(done.load(), 42);
+}
+
+TEST(dmlhl_work_stealing_executor, execution_interface)
+{
+    constexpr auto size = 1024u;
+
+    auto src = std::vector<dml::byte_t>(size, 7u);
+    auto dst = std::vector<dml::byte_t>(size, 0u);
+
+    auto executor       = dml::work_stealing_executor(2u);
+    auto exec_interface = dml::execution_interface(executor, std::allocator<dml::byte_t>());
+
+    auto status = std::atomic<int>(-1);
+
+    exec_interface.execute([&]() {
+        auto result = dml::execute<dml::software>(dml::mem_move, dml::make_view(src), dml::make_view(dst));
+        status.store(static_cast<int>(result.status));
+    });
+
+    while (status.load() == -1)
+    {
+        std::this_thread::yield();
+    }
+
+    ASSERT_EQ(status.load(), static_cast<int>(dml::status_code::ok));
+    ASSERT_EQ(src, dst);
+}
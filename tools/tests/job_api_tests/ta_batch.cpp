@@ -398,7 +398,57 @@ namespace dml
         append_flush(seed, lib_job, ref_job);
     }
 
+    /**
+     * @brief Tests CRC tasks set for independent buffers at once against the reference CRC of every buffer
+     */
+    DML_UNIT_TEST_GENERATOR(dml_batch_crc_buffers, ta_crc_values)
+    {
+        constexpr auto buffers_count = 10u;
+        auto           batch_size    = 0u;
+
+        auto lib_job = dml::test::job_t(dml::test::variables_t::path);
+        ASSERT_TRUE(lib_job);
+
+        auto status = dml_get_batch_size(&*lib_job, buffers_count, &batch_size);
+        ASSERT_EQ(DML_STATUS_OK, status);
+
+        lib_job->destination_first_ptr = dml::test::global_allocator::allocate_ptr(batch_size);
+        lib_job->destination_length    = batch_size;
+        lib_job->operation             = DML_OP_BATCH;
+
+        const auto       seed = test_system::get_seed();
+        dml_crc_buffer_t buffers[buffers_count];
+
+        for (auto i = 0u; i < buffers_count; ++i)
+        {
+            buffers[i].byte_length = get_random_size(seed + i);
+            buffers[i].source_ptr  = dml::test::global_allocator::allocate_ptr(buffers[i].byte_length);
+            buffers[i].crc_seed    = seed * i;
+
+            fill_with_random(buffers[i].source_ptr, buffers[i].byte_length, seed + i);
+        }
+
+        status = dml_batch_set_crc_buffers(&*lib_job, 0u, buffers, buffers_count, 0u);
+        ASSERT_EQ(DML_STATUS_OK, status);
+
+        status = lib_job.run();
+        ASSERT_EQ(DML_STATUS_OK, status);
+
+        for (auto i = 0u; i < buffers_count; ++i)
+        {
+            auto crc_value = 0u;
+
+            status = dml_batch_get_crc(&*lib_job, i, &crc_value);
+            ASSERT_EQ(DML_STATUS_OK, status);
+
+            const auto reference = dml::reference::calculate_crc<uint32_t, DML_FLAG_CRC_READ_SEED>(
+                buffers[i].source_ptr, buffers[i].source_ptr + buffers[i].byte_length, buffers[i].crc_seed);
+            EXPECT_EQ(reference, crc_value) << "buffer " << i;
+        }
+    }
+
     // Test registers
     DML_JOB_API_TEST_REGISTER(dml_batch, ta_all_operations);
+    DML_UNIT_TEST_REGISTER(dml_batch_crc_buffers, ta_crc_values);
 
 }  // namespace dml
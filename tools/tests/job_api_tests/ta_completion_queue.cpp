@@ -0,0 +1,156 @@
+/*******************************************************************************
+ * Copyright (C) 2023 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ ******************************************************************************/
+
+#include <gtest/gtest.h>
+#include <dml/dml.h>
+#include <t_job.hpp>
+#include <t_common.hpp>
+
+namespace dml
+{
+
+TEST(dml_completion_queue, reap)
+{
+    constexpr auto jobs_count    = 16u;
+    constexpr auto capacity      = 8u;
+    constexpr auto transfer_size = 16u * 1024u;
+
+    auto src  = std::vector<std::vector<std::uint8_t>>();
+    auto dst  = std::vector<std::vector<std::uint8_t>>();
+    auto jobs = std::vector<test::job_t>();
+
+    // Jobs are not moved once created
+    jobs.reserve(jobs_count);
+
+    for (auto i = 0u; i < jobs_count; ++i)
+    {
+        src.emplace_back(transfer_size, static_cast<std::uint8_t>(i + 1u));
+        dst.emplace_back(transfer_size, 0u);
+        jobs.emplace_back(test::variables_t::path);
+
+        jobs[i]->operation             = DML_OP_MEM_MOVE;
+        jobs[i]->source_first_ptr      = src[i].data();
+        jobs[i]->destination_first_ptr = dst[i].data();
+        jobs[i]->source_length         = transfer_size;
+    }
+
+    auto entries     = std::vector<dml_completion_entry_t>(capacity);
+    auto completions = std::vector<dml_completion_entry_t>(capacity);
+    auto queue       = dml_completion_queue_t();
+    auto reaped      = std::vector<bool>(jobs_count, false);
+
+    ASSERT_EQ(DML_STATUS_OK, dml_init_completion_queue(&queue, entries.data(), capacity));
+
+    auto submitted = 0u;
+    auto completed = 0u;
+
+    while (completed < jobs_count)
+    {
+        // The ring is refilled, then at least half of it is reaped
+        while (submitted < jobs_count && DML_STATUS_OK == dml_submit_job_to_queue(&queue, &(*jobs[submitted]), 100u + submitted))
+        {
+            ++submitted;
+        }
+
+        auto count = 0u;
+
+        ASSERT_EQ(DML_STATUS_OK,
+                  dml_reap_completions(&queue, completions.data(), queue.count / 2u, capacity, DML_WAIT_MODE_UMWAIT, &count));
+
+        for (auto i = 0u; i < count; ++i)
+        {
+            const auto index = static_cast<std::uint32_t>(completions[i].user_data - 100u);
+
+            // Jobs come back in submission order
+            ASSERT_EQ(completed + i, index);
+            ASSERT_EQ(&(*jobs[index]), completions[i].job_ptr);
+            ASSERT_EQ(DML_STATUS_OK, completions[i].status);
+            ASSERT_FALSE(reaped[index]);
+            ASSERT_EQ(src[index], dst[index]);
+
+            reaped[index] = true;
+        }
+
+        completed += count;
+    }
+
+    ASSERT_EQ(0u, queue.count);
+}
+
+TEST(dml_completion_queue, reap_stops_at_max_count)
+{
+    constexpr auto jobs_count = 3u;
+
+    auto src  = std::vector<std::uint8_t>(64u, 1u);
+    auto dst  = std::vector<std::vector<std::uint8_t>>(jobs_count, std::vector<std::uint8_t>(64u, 0u));
+    auto jobs = std::vector<test::job_t>();
+
+    jobs.reserve(jobs_count);
+
+    auto entries    = std::vector<dml_completion_entry_t>(jobs_count);
+    auto completion = dml_completion_entry_t();
+    auto queue      = dml_completion_queue_t();
+    auto count      = 0u;
+
+    ASSERT_EQ(DML_STATUS_OK, dml_init_completion_queue(&queue, entries.data(), jobs_count));
+
+    for (auto i = 0u; i < jobs_count; ++i)
+    {
+        jobs.emplace_back(test::variables_t::path);
+
+        jobs[i]->operation             = DML_OP_MEM_MOVE;
+        jobs[i]->source_first_ptr      = src.data();
+        jobs[i]->destination_first_ptr = dst[i].data();
+        jobs[i]->source_length         = 64u;
+
+        ASSERT_EQ(DML_STATUS_OK, dml_submit_job_to_queue(&queue, &(*jobs[i]), i));
+    }
+
+    // Every job completes, but only one is taken per call
+    for (auto i = 0u; i < jobs_count; ++i)
+    {
+        ASSERT_EQ(DML_STATUS_OK, dml_wait_job(&(*jobs[i]), DML_WAIT_MODE_BUSY_POLL));
+    }
+
+    for (auto i = 0u; i < jobs_count; ++i)
+    {
+        ASSERT_EQ(DML_STATUS_OK, dml_reap_completions(&queue, &completion, 0u, 1u, DML_WAIT_MODE_BUSY_POLL, &count));
+        ASSERT_EQ(1u, count);
+        ASSERT_EQ(i, completion.user_data);
+        ASSERT_EQ(jobs_count - i - 1u, queue.count);
+    }
+}
+
+TEST(dml_completion_queue, limits)
+{
+    auto job     = test::job_t(test::variables_t::path);
+    auto entry   = dml_completion_entry_t();
+    auto queue   = dml_completion_queue_t();
+    auto count   = 0u;
+    auto src     = std::vector<std::uint8_t>(64u, 1u);
+    auto dst     = std::vector<std::uint8_t>(64u, 0u);
+
+    ASSERT_EQ(DML_STATUS_LIMITS_ERROR, dml_init_completion_queue(&queue, &entry, 0u));
+    ASSERT_EQ(DML_STATUS_OK, dml_init_completion_queue(&queue, &entry, 1u));
+
+    job->operation             = DML_OP_MEM_MOVE;
+    job->source_first_ptr      = src.data();
+    job->destination_first_ptr = dst.data();
+    job->source_length         = 64u;
+
+    ASSERT_EQ(DML_STATUS_LIMITS_ERROR, dml_reap_completions(&queue, &entry, 1u, 1u, DML_WAIT_MODE_BUSY_POLL, &count));
+
+    ASSERT_EQ(DML_STATUS_OK, dml_submit_job_to_queue(&queue, &(*job), 7u));
+    ASSERT_EQ(DML_STATUS_LIMITS_ERROR, dml_submit_job_to_queue(&queue, &(*job), 8u));
+
+    auto completion = dml_completion_entry_t();
+
+    ASSERT_EQ(DML_STATUS_OK, dml_reap_completions(&queue, &completion, 1u, 1u, DML_WAIT_MODE_BUSY_POLL, &count));
+    ASSERT_EQ(1u, count);
+    ASSERT_EQ(7u, completion.user_data);
+    ASSERT_EQ(src, dst);
+}
+}
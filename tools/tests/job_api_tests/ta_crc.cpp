@@ -241,4 +241,108 @@ namespace dml
         }
     }
 
+    /**
+     * @brief Tests dml_crc_combine against the operation on the whole buffer
+     */
+    DML_JOB_API_TEST(crc, combine)
+    {
+        auto lib_job = dml::test::job_t(dml::test::variables_t::path);
+
+        ASSERT_TRUE(lib_job);
+
+        const auto seed     = test_system::get_seed();
+        auto random_seed    = dml::test::random_t<uint32_t>(seed);
+        const auto crc_seed = random_seed.get_next();
+
+        auto test_cases = dml::test::test_case_generator<uint32_t>(dml::test::get_default_test_lengths);
+
+        for (auto test_case: test_cases)
+        {
+            auto random_value   = dml::test::random_t<uint8_t>(seed);
+            std::vector<uint8_t> source(test_case, 0);
+
+            std::generate(source.begin(),
+                          source.end(),
+                          random_value);
+
+            for (const auto flags : {DML_FLAG_CRC_READ_SEED, DML_FLAG_CRC_READ_SEED | DML_FLAG_CRC_BYPASS_REFLECTION})
+            {
+                const auto head_length = test_case / 3u;
+                const auto tail_length = test_case - head_length;
+
+                auto run = [&](uint8_t *source_ptr, uint32_t length, uint32_t initial_crc, uint32_t &crc_value)
+                {
+                    crc_value                 = initial_crc;
+                    lib_job->source_first_ptr = source_ptr;
+                    lib_job->source_length    = length;
+                    lib_job->crc_checksum_ptr = &crc_value;
+                    lib_job->operation        = DML_OP_CRC;
+                    lib_job->flags            = flags;
+
+                    return lib_job.run();
+                };
+
+                uint32_t whole_crc = 0u;
+                uint32_t head_crc  = crc_seed;
+                uint32_t tail_crc  = 0u;
+
+                ASSERT_EQ(DML_STATUS_OK, run(source.data(), test_case, crc_seed, whole_crc)) << test_cases.info(test_case);
+                ASSERT_EQ(DML_STATUS_OK, run(source.data() + head_length, tail_length, 0u, tail_crc)) << test_cases.info(test_case);
+
+                if (head_length != 0u)
+                {
+                    ASSERT_EQ(DML_STATUS_OK, run(source.data(), head_length, crc_seed, head_crc)) << test_cases.info(test_case);
+                }
+
+                uint32_t combined_crc = 0u;
+
+                ASSERT_EQ(DML_STATUS_OK, dml_crc_combine(head_crc, tail_crc, tail_length, 0x1EDC6F41u, flags, &combined_crc));
+                EXPECT_EQ(whole_crc, combined_crc) << test_cases.info(test_case);
+            }
+        }
+
+        EXPECT_EQ(DML_STATUS_NULL_POINTER_ERROR, dml_crc_combine(0u, 0u, 0u, 0x1EDC6F41u, 0u, nullptr));
+    }
+
+    /**
+     * @brief Tests submission, checking and waiting around the largest transfer the software path executes directly
+     */
+    DML_JOB_API_TEST(crc, submit_and_wait)
+    {
+        auto lib_job = dml::test::job_t(dml::test::variables_t::path);
+
+        ASSERT_TRUE(lib_job);
+
+        const auto seed     = test_system::get_seed();
+        auto random_seed    = dml::test::random_t<uint32_t>(seed);
+        const auto crc_seed = random_seed.get_next();
+        const auto flags    = DML_FLAG_CRC_READ_SEED;
+
+        for (const uint32_t length : {1u, 64u, 4095u, 4096u, 4097u})
+        {
+            auto random_value   = dml::test::random_t<uint8_t>(seed);
+            std::vector<uint8_t> source(length, 0);
+            uint32_t             crc_value = crc_seed;
+
+            std::generate(source.begin(),
+                          source.end(),
+                          random_value);
+
+            lib_job->source_first_ptr = source.data();
+            lib_job->source_length    = length;
+            lib_job->crc_checksum_ptr = &crc_value;
+            lib_job->operation        = DML_OP_CRC;
+            lib_job->flags            = flags;
+
+            ASSERT_EQ(DML_STATUS_OK, dml_submit_job(&*lib_job)) << "length " << length;
+            ASSERT_EQ(DML_STATUS_OK, dml_wait_job(&*lib_job, DML_WAIT_MODE_BUSY_POLL)) << "length " << length;
+            ASSERT_EQ(DML_STATUS_OK, dml_check_job(&*lib_job)) << "length " << length;
+
+            const auto crc_reference_value =
+                dml::reference::calculate_crc<uint32_t, flags>(source.data(), source.data() + length, crc_seed);
+
+            EXPECT_EQ(crc_reference_value, crc_value) << "length " << length;
+        }
+    }
+
 }
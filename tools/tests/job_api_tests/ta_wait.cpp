@@ -51,4 +51,110 @@ TEST(dml_wait, umwait)
 
     ASSERT_EQ(src, dst);
 }
+
+TEST(dml_wait, adaptive)
+{
+    // Small enough to complete while spinning and large enough to calibrate the expected time
+    for (auto transfer_size : {4u * 1024u, 128u * 1024u, 16u * 1024u * 1024u})
+    {
+        auto src = std::vector<std::uint8_t>(transfer_size, 1);
+        auto dst = std::vector<std::uint8_t>(transfer_size, 0);
+
+        auto job = test::job_t(test::variables_t::path);
+        job->operation = DML_OP_MEM_MOVE;
+        job->source_first_ptr = src.data();
+        job->destination_first_ptr = dst.data();
+        job->source_length = transfer_size;
+
+        ASSERT_EQ(DML_STATUS_OK, dml_submit_job(&(*job)));
+        ASSERT_EQ(DML_STATUS_OK, dml_wait_job(&(*job), DML_WAIT_MODE_ADAPTIVE));
+
+        ASSERT_EQ(src, dst);
+
+        ASSERT_EQ(DML_STATUS_OK, dml_execute_job(&(*job), DML_WAIT_MODE_ADAPTIVE));
+    }
+}
+
+TEST(dml_wait, unknown_mode_waits)
+{
+    // Unknown nonzero modes wait with umwait, as when the mode was a flag
+    auto transfer_size = 128u * 1024u; // 128KB
+
+    auto src = std::vector<std::uint8_t>(transfer_size, 1);
+    auto dst = std::vector<std::uint8_t>(transfer_size, 0);
+
+    auto job = test::job_t(test::variables_t::path);
+    job->operation = DML_OP_MEM_MOVE;
+    job->source_first_ptr = src.data();
+    job->destination_first_ptr = dst.data();
+    job->source_length = transfer_size;
+
+    ASSERT_EQ(DML_STATUS_OK, dml_submit_job(&(*job)));
+    ASSERT_EQ(DML_STATUS_OK, dml_wait_job(&(*job), static_cast<dml_wait_mode_t>(0x100u)));
+
+    ASSERT_EQ(src, dst);
+}
+
+TEST(dml_wait, wait_any_and_all)
+{
+    constexpr auto jobs_count    = 5u;
+    constexpr auto transfer_size = 64u * 1024u;
+
+    for (auto wait_mode : {DML_WAIT_MODE_BUSY_POLL, DML_WAIT_MODE_UMWAIT, DML_WAIT_MODE_ADAPTIVE})
+    {
+        auto src  = std::vector<std::vector<std::uint8_t>>();
+        auto dst  = std::vector<std::vector<std::uint8_t>>();
+        auto jobs = std::vector<test::job_t>();
+        auto ptrs = std::vector<dml_job_t *>();
+
+        // Jobs are not moved once created
+        jobs.reserve(jobs_count);
+
+        for (auto i = 0u; i < jobs_count; ++i)
+        {
+            src.emplace_back(transfer_size, static_cast<std::uint8_t>(i + 1u));
+            dst.emplace_back(transfer_size, 0u);
+            jobs.emplace_back(test::variables_t::path);
+        }
+
+        for (auto i = 0u; i < jobs_count; ++i)
+        {
+            jobs[i]->operation             = DML_OP_MEM_MOVE;
+            jobs[i]->source_first_ptr      = src[i].data();
+            jobs[i]->destination_first_ptr = dst[i].data();
+            jobs[i]->source_length         = transfer_size;
+
+            ptrs.push_back(&(*jobs[i]));
+            ASSERT_EQ(DML_STATUS_OK, dml_submit_job(ptrs.back()));
+        }
+
+        auto index = jobs_count;
+
+        ASSERT_EQ(DML_STATUS_OK, dml_wait_any(ptrs.data(), jobs_count, wait_mode, &index));
+        ASSERT_LT(index, jobs_count);
+        ASSERT_EQ(src[index], dst[index]);
+
+        ASSERT_EQ(DML_STATUS_OK, dml_wait_all(ptrs.data(), jobs_count, wait_mode));
+
+        auto mask = std::uint64_t(0u);
+
+        ASSERT_EQ(DML_STATUS_OK, dml_check_many(ptrs.data(), jobs_count, &mask));
+        ASSERT_EQ((std::uint64_t(1u) << jobs_count) - 1u, mask);
+
+        for (auto i = 0u; i < jobs_count; ++i)
+        {
+            ASSERT_EQ(src[i], dst[i]);
+        }
+    }
+}
+
+TEST(dml_wait, wait_any_empty)
+{
+    auto job   = test::job_t(test::variables_t::path);
+    auto ptr   = &(*job);
+    auto index = 0u;
+
+    ASSERT_EQ(DML_STATUS_LIMITS_ERROR, dml_wait_any(&ptr, 0u, DML_WAIT_MODE_BUSY_POLL, &index));
+    ASSERT_EQ(DML_STATUS_NULL_POINTER_ERROR, dml_wait_any(nullptr, 1u, DML_WAIT_MODE_BUSY_POLL, &index));
+}
 }